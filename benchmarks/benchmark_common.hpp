@@ -0,0 +1,37 @@
+#pragma once
+#include <avk/avk.hpp>
+#include <avk/root_example_implementation.hpp>
+#include <chrono>
+#include <iostream>
+
+namespace avk_benchmarks
+{
+	/** Parses the first command line argument as number of iterations, or returns the default if there is none */
+	inline size_t iterations_from_args(int argc, char** argv, size_t aDefault)
+	{
+		return argc > 1 ? static_cast<size_t>(std::stoull(argv[1])) : aDefault;
+	}
+
+	/** Creates small uniform buffers, which the descriptor sets of a benchmark can refer to */
+	inline std::vector<avk::buffer> create_uniform_buffers(avk::root& aRoot, size_t aCount)
+	{
+		std::vector<avk::buffer> result;
+		result.reserve(aCount);
+		for (size_t i = 0; i < aCount; ++i) {
+			result.push_back(aRoot.create_buffer(avk::memory_usage::device, {}, avk::uniform_buffer_meta::create_from_size(256)));
+		}
+		return result;
+	}
+
+	/** Invokes aFunc with the indices [0..aIterations) and returns the average duration per invocation in nanoseconds */
+	template <typename F>
+	double nanoseconds_per_iteration(size_t aIterations, F aFunc)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < aIterations; ++i) {
+			aFunc(i);
+		}
+		const auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(aIterations);
+	}
+}
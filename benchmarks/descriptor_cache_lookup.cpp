@@ -0,0 +1,56 @@
+// Compares the two ways of looking up cached descriptor sets, on a single thread:
+//  - prepared:  prepare a descriptor_set from the bindings, then look it up (get_descriptor_set_from_cache)
+//  - bindings:  look the set up by its bindings, without preparing it (get_or_create_descriptor_sets)
+// All the lookups are cache hits; the sets are created before the measurements.
+//
+// Usage: avk_descriptor_cache_lookup [iterations]
+#include "benchmark_common.hpp"
+
+int main(int argc, char** argv)
+{
+	constexpr size_t numSets = 1024;
+	const auto numIterations = avk_benchmarks::iterations_from_args(argc, argv, 1000000);
+
+	root_example_implementation root;
+	root.device();
+	auto buffers = avk_benchmarks::create_uniform_buffers(root, numSets);
+	auto cache = root.create_descriptor_cache("lookup benchmark");
+
+	for (size_t i = 0; i < numSets; ++i) {
+		cache->get_or_create_descriptor_sets({
+			avk::descriptor_binding(0, 0, buffers[i]->as_uniform_buffer()),
+			avk::descriptor_binding(0, 1, buffers[(i + 1) % numSets]->as_uniform_buffer())
+		});
+	}
+	const auto numMissesBefore = cache->statistics().mMisses;
+
+	size_t numFound = 0;
+	const auto preparedNs = avk_benchmarks::nanoseconds_per_iteration(numIterations, [&](size_t i) {
+		const auto s = i % numSets;
+		auto set = cache->get_descriptor_set_from_cache(avk::descriptor_set::prepare(std::vector<avk::binding_data>{
+			avk::descriptor_binding(0, 0, buffers[s]->as_uniform_buffer()),
+			avk::descriptor_binding(0, 1, buffers[(s + 1) % numSets]->as_uniform_buffer())
+		}));
+		numFound += set.has_value() && set->handle() ? 1 : 0;
+	});
+
+	const auto bindingsNs = avk_benchmarks::nanoseconds_per_iteration(numIterations, [&](size_t i) {
+		const auto s = i % numSets;
+		auto sets = cache->get_or_create_descriptor_sets({
+			avk::descriptor_binding(0, 0, buffers[s]->as_uniform_buffer()),
+			avk::descriptor_binding(0, 1, buffers[(s + 1) % numSets]->as_uniform_buffer())
+		});
+		numFound += sets.front().handle() ? 1 : 0;
+	});
+
+	if (cache->statistics().mMisses != numMissesBefore || numFound != 2 * numIterations) {
+		std::cout << "Not all the lookups were cache hits; the results are not meaningful." << std::endl;
+		return 1;
+	}
+
+	std::cout << "descriptor cache lookups (hits), " << numSets << " sets, " << numIterations << " iterations:" << std::endl;
+	std::cout << "  prepared: " << preparedNs << " ns per lookup" << std::endl;
+	std::cout << "  bindings: " << bindingsNs << " ns per lookup" << std::endl;
+	std::cout << "  speedup:  " << preparedNs / bindingsNs << "x" << std::endl;
+	return 0;
+}
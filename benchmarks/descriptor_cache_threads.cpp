@@ -0,0 +1,83 @@
+// Stresses a descriptor cache with lookups from an increasing number of threads, to show how cache hits
+// scale across threads. Every thread looks up the same cached sets, starting at a different offset.
+// All the lookups are cache hits; the sets are created before the measurements.
+//
+// Usage: avk_descriptor_cache_threads [iterations per thread]
+#include "benchmark_common.hpp"
+#include <atomic>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+	constexpr size_t numSets = 1024;
+	const auto numIterations = avk_benchmarks::iterations_from_args(argc, argv, 1000000);
+	const auto maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	root_example_implementation root;
+	root.device();
+	auto buffers = avk_benchmarks::create_uniform_buffers(root, numSets);
+	auto cache = root.create_descriptor_cache("threads benchmark");
+
+	for (size_t i = 0; i < numSets; ++i) {
+		cache->get_or_create_descriptor_sets({
+			avk::descriptor_binding(0, 0, buffers[i]->as_uniform_buffer()),
+			avk::descriptor_binding(0, 1, buffers[(i + 1) % numSets]->as_uniform_buffer())
+		});
+	}
+	const auto numMissesBefore = cache->statistics().mMisses;
+
+	std::cout << "descriptor cache lookups (hits), " << numSets << " sets, " << numIterations << " iterations per thread:" << std::endl;
+	double singleThreadedRate = 0.0;
+	for (uint32_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+		std::atomic<uint32_t> numReady = 0;
+		std::atomic<bool> go = false;
+		std::atomic<size_t> numFound = 0;
+		std::vector<double> nsPerLookup(numThreads);
+		std::vector<std::thread> threads;
+		for (uint32_t t = 0; t < numThreads; ++t) {
+			threads.emplace_back([&, t]() {
+				++numReady;
+				while (!go.load()) {
+					std::this_thread::yield();
+				}
+				size_t found = 0;
+				const auto offset = t * numSets / numThreads;
+				nsPerLookup[t] = avk_benchmarks::nanoseconds_per_iteration(numIterations, [&](size_t i) {
+					const auto s = (offset + i) % numSets;
+					auto sets = cache->get_or_create_descriptor_sets({
+						avk::descriptor_binding(0, 0, buffers[s]->as_uniform_buffer()),
+						avk::descriptor_binding(0, 1, buffers[(s + 1) % numSets]->as_uniform_buffer())
+					});
+					found += sets.front().handle() ? 1 : 0;
+				});
+				numFound += found;
+			});
+		}
+		while (numReady.load() < numThreads) {
+			std::this_thread::yield();
+		}
+		go = true;
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		if (numFound.load() != numThreads * numIterations) {
+			std::cout << "Not all the lookups were cache hits; the results are not meaningful." << std::endl;
+			return 1;
+		}
+
+		// The slowest thread determines the duration of the whole run:
+		const auto maxNs = *std::max_element(std::begin(nsPerLookup), std::end(nsPerLookup));
+		const auto lookupsPerSecond = static_cast<double>(numThreads) * 1e9 / maxNs;
+		if (1 == numThreads) {
+			singleThreadedRate = lookupsPerSecond;
+		}
+		std::cout << "  " << numThreads << " thread(s): " << maxNs << " ns per lookup, " << lookupsPerSecond / 1e6 << " M lookups/s, scaling " << lookupsPerSecond / singleThreadedRate << "x" << std::endl;
+	}
+
+	if (cache->statistics().mMisses != numMissesBefore) {
+		std::cout << "Not all the lookups were cache hits; the results are not meaningful." << std::endl;
+		return 1;
+	}
+	return 0;
+}
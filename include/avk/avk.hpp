@@ -6,6 +6,8 @@
 #include <cassert>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <fstream>
@@ -13,6 +15,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <queue>
 #include <set>
@@ -21,6 +24,13 @@
 #include <string>
 #include <string_view>
 #include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
+#include <future>
+#include <chrono>
+#include <coroutine>
 #include <typeinfo>
 #include <type_traits>
 #include <utility>
@@ -28,6 +38,8 @@
 #include <vector>
 #include <concepts>
 #include <ranges>
+#include <span>
+#include <memory_resource>
 
 #include <avk/avk_log.hpp>
 #include <avk/avk_error.hpp>
@@ -169,6 +181,7 @@ namespace avk
 #include <avk/pipeline_stage.hpp>
 #include <avk/stage_and_access.hpp>
 
+#include <avk/descriptor_backend.hpp>
 #include <avk/descriptor_alloc_request.hpp>
 #include <avk/descriptor_pool.hpp>
 
@@ -203,6 +216,7 @@ namespace avk
 #include <avk/shader_binding_table.hpp>
 #include <avk/command_buffer.hpp>
 #include <avk/command_pool.hpp>
+#include <avk/command_pool_manager.hpp>
 
 #include <avk/semaphore.hpp>
 #include <avk/fence.hpp>
@@ -212,6 +226,7 @@ namespace avk
 #include <avk/sampler.hpp>
 #include <avk/image_sampler.hpp>
 #include <avk/attachment.hpp>
+#include <avk/rendering_attachment.hpp>
 
 #include <avk/input_description.hpp>
 #include <avk/push_constants.hpp>
@@ -247,6 +262,13 @@ namespace avk
 
 #include <avk/commands.hpp>
 #include <avk/queue.hpp>
+#include <avk/parallel_recorder.hpp>
+#include <avk/submission_worker.hpp>
+#include <avk/completion_tracker.hpp>
+#include <avk/queue_scheduler.hpp>
+#include <avk/streaming_uploader.hpp>
+#include <avk/uniform_ring.hpp>
+#include <avk/bindless_heap.hpp>
 
 namespace avk
 {
@@ -271,6 +293,11 @@ namespace avk
 		virtual const DISPATCH_LOADER_EXT_TYPE& dispatch_loader_ext() const		= 0;
 		virtual const AVK_MEM_ALLOCATOR_TYPE& memory_allocator() const			= 0;
 
+		/**	Which backend is used for descriptors by the descriptor caches and pipelines created through this root.
+		 *	Override to select avk::descriptor_backend::descriptor_buffer. It must not change during the root's lifetime.
+		 */
+		virtual avk::descriptor_backend descriptor_backend_in_use() const		{ return avk::descriptor_backend::descriptor_sets; }
+
 #pragma region root helper functions
 		/** Prints all the different memory types that are available on the device along with its memory property flags. */
 		void print_available_memory_types();
@@ -578,6 +605,19 @@ namespace avk
 
 #pragma region command pool and command buffer
 		command_pool create_command_pool(uint32_t aQueueFamilyIndex, vk::CommandPoolCreateFlags aCreateFlags = vk::CommandPoolCreateFlags());
+
+		/**	Create a parallel_recorder, which records chunks of commands on multiple worker threads into secondary command buffers.
+		 *	@param	aQueueFamilyIndex	Queue family index which the workers' command pools are created for
+		 *	@param	aNumWorkers			Number of worker threads. If 0, std::thread::hardware_concurrency() is used.
+		 *	@param	aNumFramesInFlight	Number of frames in flight, i.e., of sets of secondary command buffers which are recycled (see parallel_recorder_t::begin_frame)
+		 */
+		parallel_recorder create_parallel_recorder(uint32_t aQueueFamilyIndex, uint32_t aNumWorkers = 0u, uint32_t aNumFramesInFlight = 1u);
+
+		/**	Create a command_pool_manager, which manages command pools per thread, per frame in flight, and per queue family,
+		 *	and recycles their command buffers.
+		 *	@param	aNumFramesInFlight	Number of frames in flight, i.e., how many frames can be processed concurrently
+		 */
+		command_pool_manager create_command_pool_manager(uint32_t aNumFramesInFlight);
 #pragma endregion
 
 #pragma region compute pipeline
@@ -611,14 +651,19 @@ namespace avk
 #pragma endregion
 
 #pragma region descriptor pool
-		static descriptor_pool create_descriptor_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets);
-		descriptor_pool create_descriptor_pool(const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets);
+		static descriptor_pool create_descriptor_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets, vk::DescriptorPoolCreateFlags aFlags = {});
+		descriptor_pool create_descriptor_pool(const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets, vk::DescriptorPoolCreateFlags aFlags = {});
 		descriptor_cache create_descriptor_cache(std::string aName = "");
 #pragma endregion
 
 #pragma region descriptor set layout and set of descriptor set layouts
 		static void allocate_descriptor_set_layout(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, descriptor_set_layout& aLayoutToBeAllocated);
 		void allocate_descriptor_set_layout(descriptor_set_layout& aLayoutToBeAllocated);
+		/**	Create a descriptor update template for an allocated descriptor_set_layout, which is used by
+		 *	descriptor_set::write_descriptors to write all of a set's descriptors from one contiguous blob.
+		 *	Layouts with descriptor types that cannot be written through a template are left without one.
+		 */
+		static void allocate_descriptor_update_template(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, descriptor_set_layout& aAllocatedLayout);
 		descriptor_set_layout create_descriptor_set_layout_from_template(const descriptor_set_layout& aTemplate);
 		void allocate_set_of_descriptor_set_layouts(set_of_descriptor_set_layouts& aLayoutsToBeAllocated);
 		set_of_descriptor_set_layouts create_set_of_descriptor_set_layouts_from_template(const set_of_descriptor_set_layouts& aTemplate);
@@ -627,6 +672,20 @@ namespace avk
 #pragma region fence
 		static fence create_fence(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, bool aCreateInSignalledState = false, std::function<void(fence_t&)> aAlterConfigBeforeCreation = {});
 		fence create_fence(bool aCreateInSignalledState = false, std::function<void(fence_t&)> aAlterConfigBeforeCreation = {});
+
+		/**	Create a fence whose payload can be exported through VK_KHR_external_fence_fd (see fence_t::export_sync_fd).
+		 *	Requires the VK_KHR_external_fence_fd device extension.
+		 *	@param	aHandleTypes				The handle types the fence can be exported as
+		 *	@param	aCreateInSignalledState		Whether or not the fence shall be created in signalled state
+		 *	@param	aAlterConfigBeforeCreation	Use it to alter the fence_t configuration before it is actually being created.
+		 */
+		static fence create_fence_for_export(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, vk::ExternalFenceHandleTypeFlags aHandleTypes = vk::ExternalFenceHandleTypeFlagBits::eSyncFd, bool aCreateInSignalledState = false, std::function<void(fence_t&)> aAlterConfigBeforeCreation = {});
+		fence create_fence_for_export(vk::ExternalFenceHandleTypeFlags aHandleTypes = vk::ExternalFenceHandleTypeFlagBits::eSyncFd, bool aCreateInSignalledState = false, std::function<void(fence_t&)> aAlterConfigBeforeCreation = {});
+
+		/**	Create a completion_tracker, which tracks the completion of submissions without blocking,
+		 *	using fences from a pool of recycled fences.
+		 */
+		completion_tracker create_completion_tracker() const;
 #pragma endregion
 
 #pragma region framebuffer
@@ -687,6 +746,7 @@ namespace avk
 		/**	Creates a graphics pipeline based on another graphics pipeline, which serves as a template,
 		 *	which either uses the same renderpass (if it has shared ownership enabled) or creates a new
 		 *	renderpass internally using create_renderpass_from_template with the template's renderpass.
+		 *	If the template has been created for dynamic rendering, so is the new pipeline.
 		 *	@param	aTemplate					Another, already existing graphics pipeline, which serves as a template for the newly created graphics pipeline.
 		 *	@param	aAlterConfigBeforeCreation	Optional custom callback function which can be used to alter the new pipeline's config right before it is being created on the device.
 		 *	@return A new graphics pipeline instance.
@@ -697,8 +757,10 @@ namespace avk
 		 *
 		 *	It supports the following types:
 		 *   - cfg::pipeline_settings (flags)
+		 *   - cfg::dynamic_state (flags)
 		 *   - renderpass
 		 *   - avk::attachment (use either attachments or renderpass!)
+		 *   - cfg::dynamic_rendering (use instead of attachments or renderpass, for usage within command::begin_rendering)
 		 *   - input_binding_location_data (vertex input)
 		 *   - cfg::primitive_topology
 		 *   - shader_info
@@ -731,6 +793,14 @@ namespace avk
 			graphics_pipeline_config config;
 			add_config(config, renderPassAttachments, alterConfigFunction, std::move(args)...);
 
+			// Pipelines for dynamic rendering require neither a renderpass nor attachments:
+			if (config.mDynamicRendering.has_value()) {
+				if (renderPassAttachments.size() > 0 || (config.mRenderPassSubpass.has_value() && std::get<renderpass>(*config.mRenderPassSubpass).has_value())) {
+					throw avk::runtime_error("Ambiguous renderpass config! Either configure dynamic rendering XOR set a renderpass or provide attachments!");
+				}
+				return create_graphics_pipeline(std::move(config), std::move(alterConfigFunction));
+			}
+
 			// Check if render pass attachments are in renderPassAttachments XOR config => only in that case, it is clear how to proceed, fail in other cases
 			if (renderPassAttachments.size() > 0 == (config.mRenderPassSubpass.has_value() && static_cast<bool>(std::get<renderpass>(*config.mRenderPassSubpass)->handle()))) {
 				if (renderPassAttachments.size() == 0) {
@@ -946,6 +1016,72 @@ namespace avk
 #pragma region semaphore
 		static semaphore create_semaphore(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation = {});
 		semaphore create_semaphore(std::function<void(semaphore_t&)> aAlterConfigBeforeCreation = {});
+
+		/**	Create a timeline semaphore, i.e., a semaphore with a monotonically increasing 64-bit counter value.
+		 *	Requires Vulkan 1.2 or VK_KHR_timeline_semaphore, with the timelineSemaphore feature enabled.
+		 *	@param	aInitialValue				The initial counter value
+		 *	@param	aAlterConfigBeforeCreation	Use it to alter the semaphore_t configuration before it is actually being created.
+		 */
+		static semaphore create_timeline_semaphore(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, uint64_t aInitialValue = 0, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation = {});
+		semaphore create_timeline_semaphore(uint64_t aInitialValue = 0, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation = {});
+
+		/**	Create a binary semaphore whose payload can be exported through VK_KHR_external_semaphore_fd (see semaphore_t::export_sync_fd).
+		 *	Requires the VK_KHR_external_semaphore_fd device extension.
+		 *	@param	aHandleTypes				The handle types the semaphore can be exported as
+		 *	@param	aAlterConfigBeforeCreation	Use it to alter the semaphore_t configuration before it is actually being created.
+		 */
+		static semaphore create_semaphore_for_export(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, vk::ExternalSemaphoreHandleTypeFlags aHandleTypes = vk::ExternalSemaphoreHandleTypeFlagBits::eSyncFd, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation = {});
+		semaphore create_semaphore_for_export(vk::ExternalSemaphoreHandleTypeFlags aHandleTypes = vk::ExternalSemaphoreHandleTypeFlagBits::eSyncFd, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation = {});
+#pragma endregion
+
+#pragma region submission worker
+		/**	Create a submission_worker, which submits work to the given queue on a dedicated thread.
+		 *	@param	aQueue		The queue to submit to. It must outlive the submission_worker.
+		 */
+		submission_worker create_submission_worker(const queue& aQueue) const;
+#pragma endregion
+
+#pragma region queue scheduler
+		/**	Create a queue_scheduler, which distributes jobs across queues and synchronizes them automatically.
+		 *	@param	aGraphicsQueue			The queue for graphics jobs; also used for all roles which have no dedicated queue.
+		 *	@param	aAsyncComputeQueue		The queue for async compute jobs, e.g., selected with queue_selection_preference::specialized_queue
+		 *	@param	aTransferQueue			The queue for transfer jobs, e.g., selected with queue_selection_preference::specialized_queue
+		 *	@param	aNumFramesInFlight		Number of frames in flight, used for recycling the jobs' command buffers
+		 *	All the queues must outlive the queue_scheduler.
+		 */
+		queue_scheduler create_queue_scheduler(const queue& aGraphicsQueue, const queue* aAsyncComputeQueue = nullptr, const queue* aTransferQueue = nullptr, uint32_t aNumFramesInFlight = 1u);
+#pragma endregion
+
+#pragma region streaming uploader
+		/**	Create a streaming_uploader, which uploads buffer and image data on the given transfer queue.
+		 *	@param	aTransferQueue				The queue to perform the uploads on. It must outlive the streaming_uploader.
+		 *	@param	aConsumerQueueFamilyIndex	The queue family which uses the uploaded resources
+		 *	@param	aMinStagingBufferSize		Minimum size of the staging buffers, which are recycled
+		 *	@param	aTickInterval				If set, a background thread invokes streaming_uploader_t::tick in these intervals
+		 */
+		streaming_uploader create_streaming_uploader(const queue& aTransferQueue, uint32_t aConsumerQueueFamilyIndex, vk::DeviceSize aMinStagingBufferSize = 16 * 1024 * 1024, std::optional<std::chrono::microseconds> aTickInterval = {});
+#pragma endregion
+
+#pragma region uniform ring
+		/**	Create a uniform_ring, which hands out aligned sub-allocations of one persistently mapped buffer per frame in flight.
+		 *	@param	aBytesPerFrame			Size of each frame's region in bytes; it is rounded up to the required alignment
+		 *	@param	aNumFramesInFlight		Number of frames in flight, i.e., number of regions
+		 *	@param	aUsableAsStorageBuffer	If true, the buffer can also be bound as (dynamic) storage buffer, and
+		 *									sub-allocations are aligned to the storage buffer offset alignment, too.
+		 */
+		uniform_ring create_uniform_ring(vk::DeviceSize aBytesPerFrame, uint32_t aNumFramesInFlight, bool aUsableAsStorageBuffer = false);
+#pragma endregion
+
+#pragma region bindless heap
+		/**	Create a bindless_heap with one update-after-bind descriptor set per kind of resources.
+		 *	@param	aMaxSampledImages		Capacity for image views
+		 *	@param	aMaxSamplers			Capacity for samplers
+		 *	@param	aMaxStorageBuffers		Capacity for storage buffers
+		 *	@param	aNumFramesInFlight		Number of frames in flight, which determines when removed indices can be reused
+		 *	@param	aShaderStages			The shader stages which access the resources
+		 *	Throws under the descriptor_buffer backend, which does not support update-after-bind layouts.
+		 */
+		bindless_heap create_bindless_heap(uint32_t aMaxSampledImages, uint32_t aMaxSamplers, uint32_t aMaxStorageBuffers, uint32_t aNumFramesInFlight, shader_type aShaderStages = shader_type::all);
 #pragma endregion
 
 #pragma region shader
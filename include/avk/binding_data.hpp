@@ -101,6 +101,27 @@ namespace avk
 		const vk::BufferView* texel_buffer_view_info(descriptor_set& aDescriptorSet) const;
 	};
 
+	/**	Pipeline configuration which declares the descriptor set with the given set-id as push descriptor set.
+	 *	Its descriptors are not allocated from a pool, but recorded into the command buffer with command::push_descriptors.
+	 *	At most one descriptor set of a pipeline can be a push descriptor set. Requires VK_KHR_push_descriptor.
+	 */
+	struct push_descriptor_set
+	{
+		uint32_t mSetId;
+	};
+
+	/**	Pipeline configuration which specifies additional create flags and per-binding flags for the
+	 *	descriptor set layout with the given set-id, e.g., for update-after-bind and partially bound
+	 *	bindings (see bindless_heap_t::layout_flags).
+	 */
+	struct descriptor_set_layout_flags
+	{
+		uint32_t mSetId;
+		vk::DescriptorSetLayoutCreateFlags mCreateFlags;
+		/** One entry per binding of the set, in binding order; or empty */
+		std::vector<vk::DescriptorBindingFlags> mBindingFlags;
+	};
+
 	/** Compares two `binding_data` instances for equality, but only in
 	*	in terms of their set-ids and binding-ids. 
 	*	It does not consider equality or inequality of other members 
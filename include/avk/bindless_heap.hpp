@@ -0,0 +1,114 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/** The kinds of resources which a bindless_heap can hold, each in a separate descriptor set */
+	enum struct bindless_resource
+	{
+		sampled_image,
+		sampler,
+		storage_buffer
+	};
+
+	/**	A bindless resource heap: One large, update-after-bind, partially bound descriptor set per kind of
+	 *	resource (see bindless_resource), each with one single array binding at binding 0.
+	 *	Resources are added to the heap once, and shaders access them by their index into the array,
+	 *	instead of binding separate descriptor sets for every material. Requires descriptor indexing
+	 *	(Vulkan 1.2 or VK_EXT_descriptor_indexing) with the respective update-after-bind features enabled.
+	 *
+	 *	Indices are handed out from a free-list. Removed indices are only reused once the GPU has retired
+	 *	all the frames which might still access them, i.e., after number-of-frames-in-flight further
+	 *	invocations of begin_frame().
+	 *
+	 *	The descriptor sets' layouts must be part of the pipelines' layouts, e.g.:
+	 *	  auto pipeline = root.create_graphics_pipeline_for(...,
+	 *	      heap->binding(avk::bindless_resource::sampled_image, 1), heap->layout_flags(avk::bindless_resource::sampled_image, 1),
+	 *	      heap->binding(avk::bindless_resource::sampler, 2), heap->layout_flags(avk::bindless_resource::sampler, 2));
+	 *	  avk::command::bind_descriptors(pipeline->layout(), { heap->descriptor_set_for(avk::bindless_resource::sampled_image, 1), heap->descriptor_set_for(avk::bindless_resource::sampler, 2) });
+	 *
+	 *	All methods can be invoked from multiple threads concurrently. The added resources must stay alive until they have
+	 *	been removed and the frames which might still access them have been retired.
+	 */
+	class bindless_heap_t
+	{
+		friend class root;
+
+	public:
+		bindless_heap_t() = default;
+		bindless_heap_t(bindless_heap_t&&) noexcept = default;
+		bindless_heap_t(const bindless_heap_t&) = delete;
+		bindless_heap_t& operator=(bindless_heap_t&&) noexcept = default;
+		bindless_heap_t& operator=(const bindless_heap_t&) = delete;
+		~bindless_heap_t() = default;
+
+		/**	Add an image view which shaders can sample from, and return its index into the sampled_image array.
+		 *	@param	aImageView		The image view
+		 *	@param	aLayout			The layout which the image view is in when shaders access it
+		 */
+		uint32_t add(const image_view_t& aImageView, avk::layout::image_layout aLayout = avk::layout::shader_read_only_optimal);
+
+		/** Add a sampler, and return its index into the sampler array. */
+		uint32_t add(const sampler_t& aSampler);
+
+		/** Add a buffer, which is accessed as storage buffer in its entirety, and return its index into the storage_buffer array. */
+		uint32_t add(const buffer_t& aBuffer);
+
+		/**	Remove a resource from the heap. Its index is reused only after the frames in flight which
+		 *	might still access it have been retired, see begin_frame().
+		 */
+		void remove(bindless_resource aKind, uint32_t aIndex);
+
+		/**	Signal the beginning of a new frame, which makes the indices that have been removed
+		 *	number-of-frames-in-flight frames ago available for reuse.
+		 *	@param	aFrameId	Index of the current frame, which must increase monotonically
+		 */
+		void begin_frame(int64_t aFrameId);
+
+		/** The maximum number of resources of the given kind */
+		uint32_t capacity(bindless_resource aKind) const { return mHeaps[kind_index(aKind)].mCapacity; }
+		/** The number of resources of the given kind which are currently in the heap, or waiting for their indices to be reused */
+		uint32_t num_used(bindless_resource aKind) const;
+
+		/**	The binding of the given kind's descriptor set, to be passed to pipeline creation along with layout_flags().
+		 *	@param	aKind		The kind of resources
+		 *	@param	aSetId		The set-id which the shaders use for this kind of resources
+		 */
+		binding_data binding(bindless_resource aKind, uint32_t aSetId) const;
+
+		/** The layout flags of the given kind's descriptor set, to be passed to pipeline creation along with binding(). */
+		descriptor_set_layout_flags layout_flags(bindless_resource aKind, uint32_t aSetId) const;
+
+		/** The descriptor set of the given kind, to be bound with bind_descriptors at the given set-id. */
+		descriptor_set descriptor_set_for(bindless_resource aKind, uint32_t aSetId) const;
+
+		/** The descriptor set layout of the given kind */
+		const descriptor_set_layout& layout(bindless_resource aKind) const { return mHeaps[kind_index(aKind)].mLayout; }
+
+	private:
+		// One descriptor set per kind of resources:
+		struct heap
+		{
+			uint32_t mCapacity = 0;
+			descriptor_set_layout mLayout;
+			descriptor_set mDescriptorSet;
+			uint32_t mNumAllocated = 0; // Indices [0..mNumAllocated) have been handed out at least once
+			std::vector<uint32_t> mFreeIndices;
+			std::deque<std::tuple<uint32_t, int64_t>> mRemovedIndices; // Index and frame-id of its removal
+		};
+
+		static size_t kind_index(bindless_resource aKind) { return static_cast<size_t>(aKind); }
+		uint32_t allocate_index(bindless_resource aKind);
+		void write(bindless_resource aKind, uint32_t aIndex, const vk::DescriptorImageInfo* aImageInfo, const vk::DescriptorBufferInfo* aBufferInfo);
+
+		const root* mRoot = nullptr;
+		vk::ShaderStageFlags mShaderStages;
+		uint32_t mNumFramesInFlight = 1;
+		int64_t mCurrentFrameId = 0;
+		std::shared_ptr<descriptor_pool> mPool;
+		std::array<heap, 3> mHeaps;
+		std::unique_ptr<std::mutex> mMutex;
+	};
+
+	using bindless_heap = owning_resource<bindless_heap_t>;
+}
@@ -203,6 +203,30 @@ namespace avk
 		/** Get a buffer_descriptor for binding this buffer as a uniform buffer. */
 		auto as_storage_buffer() const { return get_buffer_descriptor<storage_buffer_meta>(); }
 
+		/**	Get a buffer_descriptor for binding this buffer as a dynamic uniform buffer.
+		 *	The offset into the buffer is not part of the descriptor, but passed to bind_descriptors as dynamic offset.
+		 *	@param	aRange	The number of bytes which are visible to shaders, starting at the dynamic offset
+		 */
+		auto as_dynamic_uniform_buffer(vk::DeviceSize aRange) const
+		{
+			auto result = get_buffer_descriptor<uniform_buffer_meta>();
+			result.mDescriptorType = vk::DescriptorType::eUniformBufferDynamic;
+			result.mDescriptorInfo.setOffset(0).setRange(aRange);
+			return result;
+		}
+
+		/**	Get a buffer_descriptor for binding this buffer as a dynamic storage buffer.
+		 *	The offset into the buffer is not part of the descriptor, but passed to bind_descriptors as dynamic offset.
+		 *	@param	aRange	The number of bytes which are visible to shaders, starting at the dynamic offset
+		 */
+		auto as_dynamic_storage_buffer(vk::DeviceSize aRange) const
+		{
+			auto result = get_buffer_descriptor<storage_buffer_meta>();
+			result.mDescriptorType = vk::DescriptorType::eStorageBufferDynamic;
+			result.mDescriptorInfo.setOffset(0).setRange(aRange);
+			return result;
+		}
+
 		/** Fill buffer with data.
 		 *  The buffer's size is determined from its metadata.
 		 *	Please note: The returned command will not contain any sort of lifetime handling measure for the given buffer.
@@ -31,6 +31,8 @@ namespace avk
 	}
 	class sync_type_command;
 	using recorded_commands_t = std::variant<command::state_type_command, command::action_type_command, sync::sync_type_command>;
+	// A list of recorded commands which allocates its memory from a std::pmr::memory_resource, like avk::command::arena:
+	using recorded_commands_arena_list = std::pmr::vector<recorded_commands_t>;
 
 	using bottom_level_acceleration_structure = avk::owning_resource<bottom_level_acceleration_structure_t>;
 	//using buffer = avk::owning_resource<buffer_t>;
@@ -115,6 +117,16 @@ namespace avk
 		uint32_t mGroupIndex;
 	};
 
+	/** Counts the binds which have been skipped by a command buffer, because the same state was bound already */
+	struct elided_binds_counters
+	{
+		uint64_t mPipelines = 0;
+		uint64_t mDescriptorSets = 0;
+		uint64_t mVertexBuffers = 0;
+		uint64_t mIndexBuffers = 0;
+		uint64_t mPushConstants = 0;
+	};
+
 	/** A command buffer which has been created for a certain queue family */
 	class command_buffer_t
 	{
@@ -209,34 +221,151 @@ namespace avk
 		 */
 		void record(std::vector<avk::recorded_commands_t> aRecordedCommandsAndSyncInstructions);
 
+		/**	Record a list of commands which has been allocated from an avk::command::arena directly into the given command buffer.
+		 *	I.e., when calling this method, the actions of the given commands are
+		 *	immediately executed, recording the operations into this command buffer.
+		 *	Resources which are lifetime-handled by the action-type commands (including nested ones) are moved into
+		 *	this command buffer, so that the list's memory can be released together with its arena afterwards.
+		 */
+		template <typename A> requires std::same_as<A, std::pmr::polymorphic_allocator<avk::recorded_commands_t>>
+		void record(std::vector<avk::recorded_commands_t, A>&& aRecordedCommandsAndSyncInstructions)
+		{
+			record_and_take_over_lifetimes(aRecordedCommandsAndSyncInstructions);
+		}
+
 		/** Prepare a command buffer for re-recording.
 		 *   This essentially calls (and removes) any custom deleters, and removes any post-execution-handlers.
 		 *   Call this method before re-recording an existing command buffer.
 		 */
 		void prepare_for_reuse();
 
+		/** Destroy all the resources whose lifetimes are handled by this command buffer.
+		 *   Call this method only after the command buffer has completed execution.
+		 */
+		void release_lifetime_handled_resources();
+
 		/** Calls prepare_for_reuse() and then vkResetCommandBuffer
 		 */
 		void reset();
 
 
+		/**	Set the inheritance info which is used when beginning to record into this command buffer.
+		 *	Required for secondary command buffers.
+		 */
+		command_buffer_t& set_inheritance_info(vk::CommandBufferInheritanceInfo aInheritanceInfo)
+		{
+			mInheritanceInfo = aInheritanceInfo;
+			return *this;
+		}
+
+		/** Set the usage flags which are used when beginning to record into this command buffer, e.g., for re-recording it for a different purpose. */
+		command_buffer_t& set_usage_flags(vk::CommandBufferUsageFlags aUsageFlags)
+		{
+			mBeginInfo.setFlags(aUsageFlags);
+			return *this;
+		}
+
 		auto& begin_info() const { return mBeginInfo; }
 		const vk::CommandBuffer& handle() const { return mCommandBuffer.get(); }
 		const vk::CommandBuffer* handle_ptr() const { return &mCommandBuffer.get(); }
 		auto state() const { return mState; }
 
-		void bind_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, std::vector<descriptor_set> aDescriptorSets);
+		/**	Binds descriptor sets, except for those which are bound to the same set index with the same dynamic offsets already.
+		 *	Sets which have been written into a descriptor buffer (see avk::descriptor_backend::descriptor_buffer) are
+		 *	bound by setting their offsets into the descriptor buffer instead; they do not support dynamic offsets.
+		 *	@param	aDynamicOffsets		One offset per dynamic uniform/storage buffer descriptor, in the order of the
+		 *								descriptor sets and, within each set, in the order of their bindings.
+		 */
+		void bind_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, std::vector<descriptor_set> aDescriptorSets, std::vector<uint32_t> aDynamicOffsets = {});
+
+		/**	Records the writes of the given (prepared, but not allocated) descriptor set as push descriptors.
+		 *	The layout's descriptor set with the set's set-id must have been created for push descriptors.
+		 *	Requires VK_KHR_push_descriptor.
+		 */
+		void push_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, descriptor_set aPreparedSet);
+
+		/**	Binds a pipeline, unless the same pipeline is bound to the given bind point already.
+		 *	@param	aBindingPoint		The bind point to bind the pipeline to
+		 *	@param	aPipelineHandle		The pipeline to be bound
+		 *	@param	aLayoutHandle		The layout of the pipeline; if it differs from the layout of the pipeline bound before,
+		 *								push constants are not regarded as bound anymore.
+		 */
+		void bind_pipeline(vk::PipelineBindPoint aBindingPoint, vk::Pipeline aPipelineHandle, vk::PipelineLayout aLayoutHandle);
+
+		/** Binds vertex buffers, except for those which are bound to the same binding with the same offset already. */
+		void bind_vertex_buffers(uint32_t aFirstBinding, uint32_t aBindingCount, const vk::Buffer* aBuffers, const vk::DeviceSize* aOffsets);
+
+		/** Binds an index buffer, unless the same index buffer is bound with the same offset and index type already. */
+		void bind_index_buffer(vk::Buffer aBuffer, vk::DeviceSize aOffset, vk::IndexType aIndexType);
+
+		/** Updates push constants, unless the same values have been pushed for the same layout, stages, and range already. */
+		void push_constants(vk::PipelineLayout aLayoutHandle, vk::ShaderStageFlags aStageFlags, uint32_t aOffset, uint32_t aSize, const void* aValues);
+
+		/**	Forget about the state which is currently bound, so that the next binds are not skipped.
+		 *	This must be invoked after state has been bound through handle() directly, e.g., within custom commands.
+		 */
+		void invalidate_bound_state();
+
+		/**	Enable or disable skipping of redundant binds (enabled by default).
+		 *	If disabled, every bind is recorded, like it has been requested.
+		 */
+		command_buffer_t& set_redundant_bind_filtering(bool aEnabled) { mRedundantBindFilteringEnabled = aEnabled; return *this; }
+
+		/** How many binds have been skipped since recording has begun, because the same state was bound already */
+		const auto& elided_binds() const { return mElidedBinds; }
 
 		void save_subpass_contents_state(vk::SubpassContents x) { mSubpassContentsState = x; }
 		
 		[[nodiscard]] const auto* root_ptr() const { return mRoot; }
 
 	private:
+		void record_and_take_over_lifetimes(std::span<avk::recorded_commands_t> aRecordedCommandsAndSyncInstructions);
+
+		// Push constant values which have been recorded for a range of a pipeline layout:
+		struct pushed_constants
+		{
+			vk::ShaderStageFlags mStageFlags;
+			uint32_t mOffset;
+			std::vector<uint8_t> mValues;
+		};
+
+		// A descriptor set which has been bound, together with its dynamic offsets, or its offset into the bound descriptor buffer:
+		struct bound_descriptor_set
+		{
+			vk::DescriptorSet mHandle;
+			std::vector<uint32_t> mDynamicOffsets;
+			std::optional<vk::DeviceSize> mDescriptorBufferOffset;
+		};
+
+		// The state which is currently bound to this command buffer:
+		struct bound_state
+		{
+			// Per bind point (see bind_point_index):
+			std::array<vk::Pipeline, 3> mPipelines;
+			std::array<vk::PipelineLayout, 3> mDescriptorSetsLayouts;
+			std::array<std::vector<bound_descriptor_set>, 3> mDescriptorSets; // indexed by set id
+			vk::DeviceAddress mDescriptorBufferAddress = 0;
+			// Vertex buffers and offsets, indexed by binding:
+			std::vector<vk::Buffer> mVertexBuffers;
+			std::vector<vk::DeviceSize> mVertexBufferOffsets;
+			vk::Buffer mIndexBuffer;
+			vk::DeviceSize mIndexBufferOffset = 0;
+			vk::IndexType mIndexType = vk::IndexType::eUint16;
+			vk::PipelineLayout mPushConstantsLayout;
+			std::vector<pushed_constants> mPushConstants;
+		};
+
+		static size_t bind_point_index(vk::PipelineBindPoint aBindingPoint);
+#if VK_HEADER_VERSION >= 235
+		void bind_descriptors_from_descriptor_buffer(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, const std::vector<descriptor_set>& aDescriptorSets);
+#endif
+
 		const root* mRoot;
 		std::shared_ptr<vk::UniqueHandle<vk::CommandPool, DISPATCH_LOADER_CORE_TYPE>> mCommandPool;
 
 		command_buffer_state mState;
 		vk::CommandBufferBeginInfo mBeginInfo;
+		std::optional<vk::CommandBufferInheritanceInfo> mInheritanceInfo;
 		vk::UniqueHandle<vk::CommandBuffer, DISPATCH_LOADER_CORE_TYPE> mCommandBuffer;
 		vk::SubpassContents mSubpassContentsState;
 		
@@ -246,6 +375,10 @@ namespace avk
 		std::optional<avk::unique_function<void()>> mCustomDeleter;
 		
 		std::vector<any_owning_resource_t> mLifetimeHandledResources;
+
+		bool mRedundantBindFilteringEnabled = true;
+		bound_state mBoundState;
+		elided_binds_counters mElidedBinds;
 	};
 
 	// Typedef for a variable representing an owner of a command_buffer
@@ -35,6 +35,11 @@ namespace avk
 			
 		command_buffer alloc_command_buffer(vk::CommandBufferUsageFlags aUsageFlags = {}, vk::CommandBufferLevel aLevel = vk::CommandBufferLevel::ePrimary);
 
+		/**	Reset the command pool via vkResetCommandPool, which resets all command buffers allocated from it at once.
+		 *	None of its command buffers must be in the pending state.
+		 */
+		void reset(vk::CommandPoolResetFlags aFlags = {});
+
 		[[nodiscard]] const auto* root_ptr() const { return mRoot; }
 
 	private:
@@ -0,0 +1,111 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Manages command pools per thread, per frame in flight, and per queue family,
+	 *	and hands out command buffers which are recycled across frames.
+	 *
+	 *	Command pools are not thread-safe. This manager creates one pool for each combination of
+	 *	(thread, frame in flight, queue family), so that every thread can record into the command
+	 *	buffers it gets from get_command_buffer() without any further synchronization.
+	 *
+	 *	Command buffers are never freed individually. Instead, once the GPU has finished executing
+	 *	all the command buffers of a frame in flight, call reset_frame() for its index, which resets all
+	 *	the pools of that frame in flight at once via vkResetCommandPool. Afterwards, all of their
+	 *	command buffers are handed out again, i.e., after the first few frames, no more command buffers
+	 *	need to be allocated.
+	 *
+	 *	Pools of threads which have stopped recording (e.g., because they have exited) are released by reset_frame()
+	 *	once they have not been used for num_idle_resets_before_release() consecutive resets of their frame in flight.
+	 *	release_thread_pools() releases the pools of a thread right away.
+	 *
+	 *	The command buffers are owned by this manager. Only references to them are handed out.
+	 */
+	class command_pool_manager_t
+	{
+		friend class root;
+
+	public:
+		command_pool_manager_t() = default;
+		command_pool_manager_t(command_pool_manager_t&&) noexcept = default;
+		command_pool_manager_t(const command_pool_manager_t&) = delete;
+		command_pool_manager_t& operator=(command_pool_manager_t&&) noexcept = default;
+		command_pool_manager_t& operator=(const command_pool_manager_t&) = delete;
+		~command_pool_manager_t() = default;
+
+		/** The number of frames in flight this manager has been created for */
+		auto num_frames_in_flight() const { return mNumFramesInFlight; }
+
+		/**	Get a command buffer which can be used by the calling thread during the given frame in flight.
+		 *	Command buffers which have been handed out since the last reset_frame() for the same
+		 *	frame in flight, are not handed out again.
+		 *	@param	aFrameInFlightIndex		Index of the frame in flight; is taken modulo num_frames_in_flight().
+		 *	@param	aQueueFamilyIndex		The queue family which the command buffer will be submitted to
+		 *	@param	aLevel					Primary or secondary command buffer
+		 *	@return	A reference to a command buffer, which is owned by this manager. It must only be used by the calling thread.
+		 */
+		command_buffer_t& get_command_buffer(uint32_t aFrameInFlightIndex, uint32_t aQueueFamilyIndex, vk::CommandBufferLevel aLevel = vk::CommandBufferLevel::ePrimary);
+
+		/**	Reset all the command pools of the given frame in flight, so that their command buffers can be handed out again.
+		 *	This must only be called after the GPU has finished executing all the command buffers of this frame in flight
+		 *	(e.g., after having waited on the frame's fence or timeline semaphore value), and not concurrently to
+		 *	get_command_buffer() calls for the same frame in flight.
+		 *	Also invokes prepare_for_reuse() for all of the command buffers that have been handed out.
+		 *	@param	aFrameInFlightIndex		Index of the frame in flight; is taken modulo num_frames_in_flight().
+		 */
+		void reset_frame(uint32_t aFrameInFlightIndex);
+
+		/**	Destroy all the command pools of the given thread, together with their command buffers.
+		 *	This must only be called after the GPU has finished executing all the command buffers which the thread has
+		 *	gotten from this manager, and not concurrently to get_command_buffer() calls of that thread.
+		 *	@param	aThreadId		The thread whose pools shall be released; by default, the calling thread.
+		 */
+		void release_thread_pools(std::thread::id aThreadId = std::this_thread::get_id());
+
+		/** The number of consecutive resets of its frame in flight without any command buffer having been handed out, after which reset_frame() releases a pool */
+		static constexpr uint32_t num_idle_resets_before_release() { return 3u; }
+
+		/** The number of command buffers which are currently allocated. Stays constant in steady-state. */
+		size_t num_allocated_command_buffers() const;
+
+	private:
+		struct pool_key
+		{
+			std::thread::id mThreadId;
+			uint32_t mFrameInFlightIndex;
+			uint32_t mQueueFamilyIndex;
+
+			bool operator==(const pool_key& aOther) const = default;
+		};
+
+		struct pool_key_hash
+		{
+			size_t operator()(const pool_key& aKey) const noexcept
+			{
+				size_t h = 0;
+				avk::hash_combine(h, aKey.mThreadId, aKey.mFrameInFlightIndex, aKey.mQueueFamilyIndex);
+				return h;
+			}
+		};
+
+		struct pool_and_buffers
+		{
+			command_pool mCommandPool;
+			std::vector<command_buffer> mPrimaryCommandBuffers;
+			std::vector<command_buffer> mSecondaryCommandBuffers;
+			size_t mNumPrimaryInUse = 0;
+			size_t mNumSecondaryInUse = 0;
+			uint32_t mNumIdleResets = 0;
+		};
+
+		root* mRoot = nullptr;
+		uint32_t mNumFramesInFlight = 1;
+		// Protects mPools and mNumAllocatedCommandBuffers:
+		std::unique_ptr<std::mutex> mMutex = std::make_unique<std::mutex>();
+		std::unordered_map<pool_key, std::unique_ptr<pool_and_buffers>, pool_key_hash> mPools;
+		size_t mNumAllocatedCommandBuffers = 0;
+	};
+
+	using command_pool_manager = owning_resource<command_pool_manager_t>;
+}
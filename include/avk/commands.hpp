@@ -115,6 +115,13 @@ namespace avk
 				return *this;
 			}
 
+			// Replaces the source and destination stages of this sync_type_command:
+			sync_type_command& with_stages(avk::stage::execution_dependency aStages)
+			{
+				mStages = aStages;
+				return *this;
+			}
+
 			// Adds an queue family ownership transfer to this sync_type_command:
 			sync_type_command& with_queue_family_ownership_transfer(uint32_t aSrcQueueFamilyIndex, uint32_t aDstQueueFamilyIndex)
 			{
@@ -338,7 +345,7 @@ namespace avk
 					lDataSize = dataSize,
 					aData
 				] (avk::command_buffer_t& cb) {
-					cb.handle().pushConstants(
+					cb.push_constants(
 						lLayoutHandle,
 						lStageFlags,
 						0, // TODO: How to deal with offset?
@@ -378,7 +385,7 @@ namespace avk
 					lDataSize = dataSize,
 					aDataPtr
 				] (avk::command_buffer_t& cb) {
-					cb.handle().pushConstants(
+					cb.push_constants(
 						lLayoutHandle,
 						lStageFlags,
 						0, // TODO: How to deal with offset?
@@ -401,7 +408,8 @@ namespace avk
 			avk::sync::sync_hint mSyncHint = {};
 			std::vector<std::tuple<std::variant<vk::Image, vk::Buffer>, avk::sync::sync_hint>> mResourceSpecificSyncHints;
 			rec_fun mBeginFun = {};
-			std::vector<recorded_commands_t> mNestedCommandsAndSyncInstructions;
+			// Allocated from the default memory resource, unless the list has been created through an avk::command::arena:
+			recorded_commands_arena_list mNestedCommandsAndSyncInstructions;
 			rec_fun mEndFun = {};
 
 			/**	Takes care of the lifetime of the given resource.
@@ -536,10 +544,109 @@ namespace avk
 			bool aSubpassesInline = true
 		);
 
+		/**	Begins and ends a render pass for a given framebuffer, with nested commands which have been allocated from an avk::command::arena.
+		 *	The nested list is taken over without copying, i.e., the returned command keeps using the arena's memory.
+		 *	Parameters are the same as for the overload which takes a std::vector of nested commands.
+		 */
+		template <typename A> requires std::same_as<A, std::pmr::polymorphic_allocator<recorded_commands_t>>
+		action_type_command render_pass(
+			const renderpass_t& aRenderpass,
+			const framebuffer_t& aFramebuffer,
+			std::vector<recorded_commands_t, A>&& aNestedCommands,
+			vk::Offset2D aRenderAreaOffset = { 0, 0 },
+			std::optional<vk::Extent2D> aRenderAreaExtent = {},
+			bool aSubpassesInline = true)
+		{
+			auto tmpBeginRenderPass = begin_render_pass_for_framebuffer(aRenderpass, aFramebuffer, aRenderAreaOffset, aRenderAreaExtent, aSubpassesInline);
+			auto tmpEndRenderPass = end_render_pass();
+
+			return action_type_command{
+				// Define a sync hint that corresponds to the implicit subpass dependencies (see specification chapter 8.1)
+				avk::sync::sync_hint {
+					tmpBeginRenderPass.mSyncHint.mDstForPreviousCmds,
+					tmpEndRenderPass.mSyncHint.mSrcForSubsequentCmds
+				},
+				std::move(tmpBeginRenderPass.mResourceSpecificSyncHints),
+				std::move(tmpBeginRenderPass.mBeginFun),
+				std::move(aNestedCommands),
+				std::move(tmpEndRenderPass.mBeginFun)
+			};
+		}
+
 		/** Advances to the next subpass within a render pass.
 		 */
 		extern action_type_command next_subpass(bool aSubpassesInline = true);
 
+		/**	Begins dynamic rendering (VK_KHR_dynamic_rendering) into the given attachments, i.e., without a renderpass and a framebuffer.
+		 *	Graphics pipelines which are bound within must have been created for dynamic rendering (see cfg::dynamic_rendering).
+		 *	@param	aColorAttachments		Color attachments, which are assigned to locations in the order in which they are given
+		 *	@param	aDepthStencilAttachment	Depth and/or stencil attachment (optional)
+		 *	@param	aRenderAreaOffset		Render area offset (default is (0,0), i.e., no offset)
+		 *	@param	aRenderAreaExtent		Render area extent (default is the full extent of the first attachment's view, i.e., of its base mip level)
+		 *	@param	aLayerCount				Number of layers which are rendered into (default is 1)
+		 *	@param	aContentsInline			Whether or not the contents are recorded inline, as opposed to in secondary command buffers (default is true)
+		 */
+		extern action_type_command begin_rendering(
+			std::vector<rendering_attachment> aColorAttachments,
+			std::optional<rendering_attachment> aDepthStencilAttachment = {},
+			vk::Offset2D aRenderAreaOffset = { 0, 0 },
+			std::optional<vk::Extent2D> aRenderAreaExtent = {},
+			uint32_t aLayerCount = 1,
+			bool aContentsInline = true
+		);
+
+		/**	Ends dynamic rendering
+		 */
+		extern action_type_command end_rendering();
+
+		/**	Begins and ends dynamic rendering into the given attachments, and supports some nested commands to be recorded in between
+		 *	@param	aColorAttachments		Color attachments, which are assigned to locations in the order in which they are given
+		 *	@param	aDepthStencilAttachment	Depth and/or stencil attachment (optional)
+		 *	@param	aNestedCommands			Nested commands to be recorded between begin and end
+		 *	@param	aRenderAreaOffset		Render area offset (default is (0,0), i.e., no offset)
+		 *	@param	aRenderAreaExtent		Render area extent (default is the full extent of the first attachment's view, i.e., of its base mip level)
+		 *	@param	aLayerCount				Number of layers which are rendered into (default is 1)
+		 *	@param	aContentsInline			Whether or not the contents are recorded inline, as opposed to in secondary command buffers (default is true)
+		 */
+		extern action_type_command rendering(
+			std::vector<rendering_attachment> aColorAttachments,
+			std::optional<rendering_attachment> aDepthStencilAttachment,
+			std::vector<recorded_commands_t> aNestedCommands = {},
+			vk::Offset2D aRenderAreaOffset = { 0, 0 },
+			std::optional<vk::Extent2D> aRenderAreaExtent = {},
+			uint32_t aLayerCount = 1,
+			bool aContentsInline = true
+		);
+
+		/**	Begins and ends dynamic rendering into the given attachments, with nested commands which have been allocated from an avk::command::arena.
+		 *	The nested list is taken over without copying, i.e., the returned command keeps using the arena's memory.
+		 *	Parameters are the same as for the overload which takes a std::vector of nested commands.
+		 */
+		template <typename A> requires std::same_as<A, std::pmr::polymorphic_allocator<recorded_commands_t>>
+		action_type_command rendering(
+			std::vector<rendering_attachment> aColorAttachments,
+			std::optional<rendering_attachment> aDepthStencilAttachment,
+			std::vector<recorded_commands_t, A>&& aNestedCommands,
+			vk::Offset2D aRenderAreaOffset = { 0, 0 },
+			std::optional<vk::Extent2D> aRenderAreaExtent = {},
+			uint32_t aLayerCount = 1,
+			bool aContentsInline = true)
+		{
+			auto tmpBeginRendering = begin_rendering(std::move(aColorAttachments), std::move(aDepthStencilAttachment), aRenderAreaOffset, aRenderAreaExtent, aLayerCount, aContentsInline);
+			auto tmpEndRendering = end_rendering();
+
+			return action_type_command{
+				avk::sync::sync_hint {
+					tmpBeginRendering.mSyncHint.mDstForPreviousCmds,
+					tmpEndRendering.mSyncHint.mSrcForSubsequentCmds
+				},
+				std::move(tmpBeginRendering.mResourceSpecificSyncHints),
+				std::move(tmpBeginRendering.mBeginFun),
+				std::move(aNestedCommands),
+				std::move(tmpEndRendering.mBeginFun)
+			};
+		}
+
 		/** Binds a graphics pipeline.
 		 *	@param	aPipeline	The graphics pipeline to bind
 		 */
@@ -557,28 +664,148 @@ namespace avk
 		extern state_type_command bind_pipeline(const ray_tracing_pipeline_t& aPipeline);
 #endif 
 
+		/** Sets the culling mode of a graphics pipeline which has been created with cfg::dynamic_state::culling_mode.
+		 *	@param	aCullingMode		The culling mode to be used by subsequent draw calls
+		 */
+		extern state_type_command set_culling_mode(cfg::culling_mode aCullingMode);
+
+		/** Sets the front face of a graphics pipeline which has been created with cfg::dynamic_state::front_face.
+		 *	@param	aFrontFace			The winding order of front faces to be used by subsequent draw calls
+		 */
+		extern state_type_command set_front_face(cfg::front_face aFrontFace);
+
+		/** Sets the primitive topology of a graphics pipeline which has been created with cfg::dynamic_state::primitive_topology.
+		 *	@param	aPrimitiveTopology	The primitive topology to be used by subsequent draw calls
+		 */
+		extern state_type_command set_primitive_topology(cfg::primitive_topology aPrimitiveTopology);
+
+		/** Enables or disables depth testing, and sets the depth compare operation of a graphics pipeline
+		 *	which has been created with cfg::dynamic_state::depth_test.
+		 *	@param	aDepthTest			The depth test config to be used by subsequent draw calls
+		 */
+		extern state_type_command set_depth_test(cfg::depth_test aDepthTest);
+
+		/** Enables or disables depth writes of a graphics pipeline which has been created with cfg::dynamic_state::depth_write.
+		 *	@param	aDepthWrite			The depth write config to be used by subsequent draw calls
+		 */
+		extern state_type_command set_depth_write(cfg::depth_write aDepthWrite);
+
+		/** Enables or disables the depth bounds test of a graphics pipeline which has been created with cfg::dynamic_state::depth_bounds_test.
+		 *	@param	aEnabled			Whether or not subsequent draw calls shall perform the depth bounds test
+		 */
+		extern state_type_command set_depth_bounds_test(bool aEnabled);
+
+		/** Enables or disables stencil testing, and sets the stencil operations of a graphics pipeline
+		 *	which has been created with cfg::dynamic_state::stencil_test.
+		 *	@param	aStencilTest		The stencil test config to be used by subsequent draw calls
+		 */
+		extern state_type_command set_stencil_test(cfg::stencil_test aStencilTest);
+
+		/** Sets whether or not geometry is discarded before rasterization by a graphics pipeline
+		 *	which has been created with cfg::dynamic_state::rasterizer_geometry_mode.
+		 *	@param	aRasterizerGeometryMode	The rasterizer geometry mode to be used by subsequent draw calls
+		 */
+		extern state_type_command set_rasterizer_geometry_mode(cfg::rasterizer_geometry_mode aRasterizerGeometryMode);
+
+		/** Enables or disables depth bias of a graphics pipeline which has been created with cfg::dynamic_state::depth_bias.
+		 *	@param	aEnabled			Whether or not subsequent draw calls shall apply depth bias
+		 */
+		extern state_type_command set_depth_bias_enabled(bool aEnabled);
+
+		/** Enables or disables primitive restart of a graphics pipeline which has been created with cfg::dynamic_state::primitive_restart.
+		 *	@param	aEnabled			Whether or not a special index value restarts the assembly of primitives in subsequent indexed draw calls
+		 */
+		extern state_type_command set_primitive_restart_enabled(bool aEnabled);
+
+#if VK_HEADER_VERSION >= 233
+		/** Sets the polygon drawing mode of a graphics pipeline which has been created with cfg::dynamic_state::polygon_drawing_mode.
+		 *	@param	aPolygonDrawingMode	The polygon drawing mode to be used by subsequent draw calls
+		 */
+		extern state_type_command set_polygon_drawing_mode(cfg::polygon_drawing_mode aPolygonDrawingMode);
+
+		/** Enables or disables depth clamping of a graphics pipeline which has been created with cfg::dynamic_state::depth_clamp.
+		 *	@param	aEnabled			Whether or not subsequent draw calls shall clamp depth values to the view frustum
+		 */
+		extern state_type_command set_depth_clamp_enabled(bool aEnabled);
+
+		/** Enables or disables color blending for color attachments of a graphics pipeline which has been
+		 *	created with cfg::dynamic_state::color_blending_enabled.
+		 *	@param	aEnabled			One value per color attachment, starting at aFirstAttachment
+		 *	@param	aFirstAttachment	Index of the first color attachment to be set
+		 */
+		extern state_type_command set_color_blending_enabled(std::vector<bool> aEnabled, uint32_t aFirstAttachment = 0u);
+
+		/** Sets the color write mask for color attachments of a graphics pipeline which has been
+		 *	created with cfg::dynamic_state::color_write_mask.
+		 *	@param	aColorChannels		One value per color attachment, starting at aFirstAttachment
+		 *	@param	aFirstAttachment	Index of the first color attachment to be set
+		 */
+		extern state_type_command set_color_write_mask(std::vector<cfg::color_channel> aColorChannels, uint32_t aFirstAttachment = 0u);
+#endif
+
 		/** Binds a graphics pipeline.
 		 *	@param	aPipelineLayout		The layout of the pipeline to bind descriptors to
 		 *	@param	aDescriptorSets		The descriptor sets to be bound
+		 *	@param	aDynamicOffsets		One offset per dynamic uniform/storage buffer descriptor, in the order of the
+		 *								descriptor sets and, within each set, in the order of their bindings.
 		 */
-		extern state_type_command bind_descriptors(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets);
+		extern state_type_command bind_descriptors(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets, std::vector<uint32_t> aDynamicOffsets = {});
 
 		/** Binds a graphics pipeline.
 		 *	@param	aPipelineLayout		The layout of the pipeline to bind descriptors to
 		 *	@param	aDescriptorSets		The descriptor sets to be bound
+		 *	@param	aDynamicOffsets		One offset per dynamic uniform/storage buffer descriptor, in the order of the
+		 *								descriptor sets and, within each set, in the order of their bindings.
 		 */
-		extern state_type_command bind_descriptors(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets);
+		extern state_type_command bind_descriptors(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets, std::vector<uint32_t> aDynamicOffsets = {});
 
 #if VK_HEADER_VERSION >= 135
 		/** Binds a graphics pipeline.
 		 *	@param	aPipelineLayout		The layout of the pipeline to bind descriptors to
 		 *	@param	aDescriptorSets		The descriptor sets to be bound
+		 *	@param	aDynamicOffsets		One offset per dynamic uniform/storage buffer descriptor, in the order of the
+		 *								descriptor sets and, within each set, in the order of their bindings.
+		 */
+		extern state_type_command bind_descriptors(std::tuple<const ray_tracing_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets, std::vector<uint32_t> aDynamicOffsets = {});
+#endif
+
+		/**	Records descriptors directly into the command buffer, without allocating a descriptor set.
+		 *	Useful for transient bindings which change frequently, since they neither require pool allocations nor cache lookups.
+		 *	All the bindings must refer to the same set-id, which must have been declared as avk::push_descriptor_set
+		 *	when the pipeline was created. Requires VK_KHR_push_descriptor.
+		 *	@param	aPipelineLayout		The layout of the pipeline to push descriptors to
+		 *	@param	aBindings			The bindings of the push descriptor set
+		 */
+		extern state_type_command push_descriptors(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<binding_data> aBindings);
+
+		/**	Records descriptors directly into the command buffer, without allocating a descriptor set.
+		 *	Useful for transient bindings which change frequently, since they neither require pool allocations nor cache lookups.
+		 *	All the bindings must refer to the same set-id, which must have been declared as avk::push_descriptor_set
+		 *	when the pipeline was created. Requires VK_KHR_push_descriptor.
+		 *	@param	aPipelineLayout		The layout of the pipeline to push descriptors to
+		 *	@param	aBindings			The bindings of the push descriptor set
 		 */
-		extern state_type_command bind_descriptors(std::tuple<const ray_tracing_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets);
+		extern state_type_command push_descriptors(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<binding_data> aBindings);
+
+#if VK_HEADER_VERSION >= 135
+		/**	Records descriptors directly into the command buffer, without allocating a descriptor set.
+		 *	Useful for transient bindings which change frequently, since they neither require pool allocations nor cache lookups.
+		 *	All the bindings must refer to the same set-id, which must have been declared as avk::push_descriptor_set
+		 *	when the pipeline was created. Requires VK_KHR_push_descriptor.
+		 *	@param	aPipelineLayout		The layout of the pipeline to push descriptors to
+		 *	@param	aBindings			The bindings of the push descriptor set
+		 */
+		extern state_type_command push_descriptors(std::tuple<const ray_tracing_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<binding_data> aBindings);
 #endif
 
 		extern action_type_command draw(uint32_t aVertexCount, uint32_t aInstanceCount, uint32_t aFirstVertex, uint32_t aFirstInstance);
 
+		/**	Issue a draw call whose parameters are read from the given address at the time of recording.
+		 *	Useful for compiled_commands, where the parameters can be changed between replays.
+		 *	@param	aParametersPtr		Pointer to the draw parameters. Must stay valid as long as this command is recorded.
+		 */
+		extern action_type_command draw(const vk::DrawIndirectCommand* aParametersPtr);
+
 		template <typename... Rest>
 		void bind_vertex_buffer(vk::Buffer* aHandlePtr, vk::DeviceSize* aOffsetPtr)
 		{
@@ -639,7 +866,7 @@ namespace avk
 					handles, offsets, 
 					aNumberOfVertices, aNumberOfInstances, aFirstVertex, aFirstInstance
 				](avk::command_buffer_t& cb) {
-					cb.handle().bindVertexBuffers(
+					cb.bind_vertex_buffers(
 						0u, // TODO: Should the first binding really always be 0?
 						static_cast<uint32_t>(N), handles.data(), offsets.data()
 					);
@@ -737,11 +964,11 @@ namespace avk
 					lIndexBufferHandle = aIndexBuffer.handle(),
 					aNumberOfInstances, aFirstIndex, aVertexOffset, aFirstInstance
 				](avk::command_buffer_t& cb) {
-					cb.handle().bindVertexBuffers(
+					cb.bind_vertex_buffers(
 						0u, // TODO: Should the first binding really always be 0?
 						lBindingCount, handles.data(), offsets.data()
 					);
-					cb.handle().bindIndexBuffer(lIndexBufferHandle, 0u, indexType);
+					cb.bind_index_buffer(lIndexBufferHandle, 0u, indexType);
 					cb.handle().drawIndexed(lNumElemments, aNumberOfInstances, aFirstIndex, aVertexOffset, aFirstInstance);
 				}
 			};
@@ -814,11 +1041,11 @@ namespace avk
 					lIndexBufferHandle = aIndexBuffer.handle(),
 					aNumberOfDraws, aParametersOffset, aParametersStride
 				](avk::command_buffer_t& cb) {
-					cb.handle().bindVertexBuffers(
+					cb.bind_vertex_buffers(
 						0u, // TODO: Should the first binding really always be 0?
 						lBindingCount, handles.data(), offsets.data()
 					);
-					cb.handle().bindIndexBuffer(lIndexBufferHandle, 0u, indexType);
+					cb.bind_index_buffer(lIndexBufferHandle, 0u, indexType);
 					cb.handle().drawIndexedIndirect(lParametersBufferHandle, aParametersOffset, aNumberOfDraws, aParametersStride);
 				}
 			};
@@ -897,11 +1124,11 @@ namespace avk
 					lDrawCountBufferHandle = aDrawCountBuffer.handle(),
 					aParametersOffset, aDrawCountOffset, aMaxNumberOfDraws, aParametersStride
 				](avk::command_buffer_t& cb) {
-					cb.handle().bindVertexBuffers(
+					cb.bind_vertex_buffers(
 						0u, // TODO: Should the first binding really always be 0?
 						lBindingCount, handles.data(), offsets.data()
 					);
-					cb.handle().bindIndexBuffer(lIndexBufferHandle, 0u, indexType);
+					cb.bind_index_buffer(lIndexBufferHandle, 0u, indexType);
 					cb.handle().drawIndexedIndirectCount(lParametersBufferHandle, aParametersOffset, lDrawCountBufferHandle, aDrawCountOffset, aMaxNumberOfDraws, aParametersStride);
 				}
 			};
@@ -931,6 +1158,12 @@ namespace avk
 		}
 
 		action_type_command dispatch(uint32_t aGroupCountX, uint32_t aGroupCountY, uint32_t aGroupCountZ);
+
+		/**	Issue a dispatch call whose group counts are read from the given address at the time of recording.
+		 *	Useful for compiled_commands, where the group counts can be changed between replays.
+		 *	@param	aGroupCountsPtr		Pointer to the group counts. Must stay valid as long as this command is recorded.
+		 */
+		action_type_command dispatch(const vk::DispatchIndirectCommand* aGroupCountsPtr);
 #endif
 
 #if VK_HEADER_VERSION >= 135
@@ -1089,6 +1322,8 @@ namespace avk
 	{
 		avk::resource_argument<avk::semaphore_t> mWaitSemaphore;
 		avk::stage::pipeline_stage_flags mDstStage;
+		// The value to wait for, if mWaitSemaphore is a timeline semaphore:
+		uint64_t mValue = 0;
 	};
 
 	inline semaphore_wait_info operator>> (avk::resource_argument<avk::semaphore_t> a, avk::stage::pipeline_stage_flags b)
@@ -1101,6 +1336,8 @@ namespace avk
 	{
 		avk::stage::pipeline_stage_flags mSrcStage;
 		avk::resource_argument<avk::semaphore_t> mSignalSemaphore;
+		// The value to signal, if mSignalSemaphore is a timeline semaphore:
+		uint64_t mValue = 0;
 	};
 
 	inline semaphore_signal_info operator>> (avk::stage::pipeline_stage_flags a, avk::resource_argument<avk::semaphore_t> b)
@@ -1108,13 +1345,45 @@ namespace avk
 		return semaphore_signal_info{ a, std::move(b) };
 	}
 
+	/**	A timeline semaphore together with a counter value, created through avk::with_value.
+	 *	Use it like a semaphore with operator>> to wait for or to signal the value, e.g.:
+	 *	  avk::with_value(myTimelineSemaphore, 42) >> avk::stage::vertex_shader
+	 */
+	struct semaphore_value_info
+	{
+		avk::resource_argument<avk::semaphore_t> mSemaphore;
+		uint64_t mValue;
+	};
+
+	inline semaphore_value_info with_value(avk::resource_argument<avk::semaphore_t> aTimelineSemaphore, uint64_t aValue)
+	{
+		return semaphore_value_info{ std::move(aTimelineSemaphore), aValue };
+	}
+
+	inline semaphore_wait_info operator>> (semaphore_value_info a, avk::stage::pipeline_stage_flags b)
+	{
+		return semaphore_wait_info{ std::move(a.mSemaphore), b, a.mValue };
+	}
+
+	inline semaphore_signal_info operator>> (avk::stage::pipeline_stage_flags a, semaphore_value_info b)
+	{
+		return semaphore_signal_info{ a, std::move(b.mSemaphore), b.mValue };
+	}
+
 
 	class recorded_command_buffer;
 
 	// Something that submits stuff to a queue.
 	// The submission itself either happens in submit() or in this class' destructor, if submit()/go()/do_it() has never been invoked before.
+	class submission_awaiter;
+	class completion_tracker_t;
+
 	class submission_data final
 	{
+		friend class submission_batch;
+		friend class submission_worker_t;
+		friend class completion_tracker_t;
+		friend class submission_awaiter;
 	public:
 		submission_data(const root* aRoot, avk::resource_argument<avk::command_buffer_t> aCommandBuffer, const queue& aQueue, const avk::recorded_command_buffer* aDangerousRecordedCommandBufferPointer = nullptr)
 			: mRoot{ aRoot }
@@ -1152,7 +1421,42 @@ namespace avk
 
 		const auto* recorded_command_buffer_ptr() const { return mDangerousRecordedCommandBufferPointer; }
 
+		/**	Submit and suspend the awaiting coroutine until the submission has completed on the GPU, e.g.:
+		 *	  co_await queue.submit(cmdBfr);
+		 *	The coroutine is resumed on the thread which waits for the completion of awaited submissions.
+		 *	See submission_awaiter for details.
+		 */
+		submission_awaiter operator co_await() &&;
+
+		/**	Like operator co_await, but the coroutine is resumed through the given scheduler, e.g.:
+		 *	  co_await queue.submit(cmdBfr).resumed_on([&myJobSystem](std::coroutine_handle<> h) { myJobSystem.schedule(h); });
+		 *	@param	aScheduler		Invoked after the submission has completed, with the coroutine to be resumed.
+		 */
+		submission_awaiter resumed_on(std::function<void(std::coroutine_handle<>)> aScheduler) &&;
+
+		/**	Like operator co_await, but if the submission neither signals a timeline semaphore nor a fence, the fence
+		 *	to wait for is taken from the given completion_tracker's pool of recycled fences, and returned to it afterwards,
+		 *	instead of creating a new fence for every co_await, e.g.:
+		 *	  co_await queue.submit(cmdBfr).awaited_with(tracker.get());
+		 *	@param	aFencePool		Must outlive the awaiting
+		 *	@param	aScheduler		Optional, see resumed_on
+		 */
+		submission_awaiter awaited_with(completion_tracker_t& aFencePool, std::function<void(std::coroutine_handle<>)> aScheduler = {}) &&;
+
+		/**	Submit and return a sync file descriptor, which becomes readable (e.g., for poll or epoll)
+		 *	once the submission has completed. The file descriptor must be closed by the caller.
+		 *	If a fence has been specified, it must have been created via root::create_fence_for_export.
+		 *	Otherwise, such a fence is created, and its lifetime is handled by the command buffer,
+		 *	which must therefore not have been passed as const reference.
+		 *	Requires the VK_KHR_external_fence_fd device extension.
+		 *	@return	The sync file descriptor, or -1 if the submission has already completed.
+		 */
+		int submit_and_export_sync_fd();
+
 	private:
+		// Fill the semaphore submit infos for all the waits and signals of this submission:
+		void gather_semaphore_submit_infos(std::vector<vk::SemaphoreSubmitInfoKHR>& aWaitSemaphoreInfos, std::vector<vk::SemaphoreSubmitInfoKHR>& aSignalSemaphoreInfos) const;
+
 		const root* mRoot = nullptr;
 		avk::resource_argument<avk::command_buffer_t> mCommandBufferToSubmit;
 		const queue* mQueueToSubmitTo;
@@ -1163,7 +1467,109 @@ namespace avk
 		const avk::recorded_command_buffer* mDangerousRecordedCommandBufferPointer;
 	};
 
+	/**	Submits a submission when a coroutine awaits it, and resumes the coroutine once the submission has completed.
+	 *
+	 *	The completion is determined through the submission's timeline semaphore signal, if it has one,
+	 *	or through its fence otherwise. If it has neither, a fence is taken from the completion_tracker which has been
+	 *	passed to submission_data::awaited_with, or created if none has been passed.
+	 *	All the awaited submissions are observed by one single thread, which blocks until one of them completes
+	 *	and resumes the coroutines,
+	 *	either directly on that thread, or by handing them to a scheduler (see submission_data::resumed_on).
+	 *	If the submission fails, or the device is lost while waiting, the exception is rethrown from co_await.
+	 */
+	class submission_awaiter final
+	{
+	public:
+		submission_awaiter(submission_data aSubmission, std::function<void(std::coroutine_handle<>)> aScheduler, completion_tracker_t* aFencePool = nullptr)
+			: mSubmission{ std::move(aSubmission) }
+			, mScheduler{ std::move(aScheduler) }
+			, mFencePool{ aFencePool }
+		{}
+		submission_awaiter(const submission_awaiter&) = delete;
+		submission_awaiter(submission_awaiter&&) noexcept = default;
+		submission_awaiter& operator=(const submission_awaiter&) = delete;
+		submission_awaiter& operator=(submission_awaiter&&) noexcept = default;
+		~submission_awaiter() = default;
+
+		bool await_ready() const noexcept { return false; }
+		bool await_suspend(std::coroutine_handle<> aCoroutine);
+		void await_resume() const;
+
+	private:
+		// The one thread which waits for all awaited submissions, defined in avk.cpp:
+		struct waiter_thread;
+
+		bool is_complete() const;
+
+		submission_data mSubmission;
+		std::function<void(std::coroutine_handle<>)> mScheduler;
+		completion_tracker_t* mFencePool;
+		std::optional<avk::fence> mCreatedFence;
+		const avk::fence_t* mFenceToWaitFor = nullptr;
+		const avk::semaphore_t* mTimelineSemaphoreToWaitFor = nullptr;
+		uint64_t mTimelineValueToWaitFor = 0;
+		std::coroutine_handle<> mCoroutine;
+		std::exception_ptr mException;
+	};
+
+	/**	Collects multiple submissions to one and the same queue and submits all of them
+	 *	with one single call to vkQueueSubmit2, i.e., one vk::SubmitInfo2KHR entry per submission.
+	 *	Every submission keeps its own set of semaphore waits and signals.
+	 *	The submissions are executed in the order in which they have been added to the batch.
+	 *
+	 *	Since vkQueueSubmit2 can only signal one fence, at most one fence can be specified
+	 *	for the whole batch---either via signaling_upon_completion on the batch, or on (exactly one of)
+	 *	the added submissions. It will be signaled after all submissions of the batch have completed.
+	 *
+	 *	If a batch has not been submitted explicitly, it will be submitted in its destructor.
+	 */
+	class submission_batch final
+	{
+	public:
+		submission_batch(const root* aRoot, const queue& aQueue)
+			: mRoot{ aRoot }
+			, mQueueToSubmitTo{ &aQueue }
+			, mSubmissionCount{ 0u }
+		{}
+		submission_batch(const submission_batch&) = delete;
+		submission_batch(submission_batch&&) noexcept;
+		submission_batch& operator=(const submission_batch&) = delete;
+		submission_batch& operator=(submission_batch&&) noexcept;
+		~submission_batch() noexcept(false);
+
+		/**	Add a command buffer to this batch.
+		 *	@return	The submission data of the added command buffer, which can be used to configure its
+		 *			semaphore waits and signals. The reference is only valid until the next submission is added.
+		 */
+		submission_data& add(avk::resource_argument<avk::command_buffer_t> aCommandBuffer);
+
+		/**	Add an already configured submission to this batch. The submission will not be submitted on its own
+		 *	anymore, but as part of this batch. It must either have no queue assigned or the same queue as this batch.
+		 *	Use submission_data::store_for_now() to pass a submission, e.g.:
+		 *	  batch.add(queue.submit(cmdBfr).waiting_for(sem >> avk::stage::transfer).store_for_now());
+		 */
+		submission_batch& add(submission_data&& aSubmission);
+
+		/** Signal the given fence after all the submissions of this batch have completed. */
+		submission_batch& signaling_upon_completion(avk::resource_argument<avk::fence_t> aFence);
+
+		bool is_sane() const { return nullptr != mRoot; }
+		auto num_submissions() const { return mSubmissions.size(); }
+
+		void submit();
+		void go() { submit(); }
+		void do_it() { submit(); }
+
+	private:
+		const root* mRoot = nullptr;
+		const queue* mQueueToSubmitTo;
+		std::vector<submission_data> mSubmissions;
+		std::optional<avk::resource_argument<avk::fence_t>> mFence;
+		uint32_t mSubmissionCount;
+	};
+
 	class recorded_commands;
+	class compiled_commands;
 
 	// This class turns a std::vector<recorded_commands_t> into an actual command buffer
 	class recorded_command_buffer final
@@ -1216,6 +1622,7 @@ namespace avk
 		recorded_commands& handle_lifetime_of(any_owning_resource_t aResource);
 
 		std::vector<recorded_commands_t> and_store();
+		compiled_commands and_compile();
 		recorded_command_buffer into_command_buffer(avk::resource_argument<avk::command_buffer_t> aCommandBuffer, bool aBeginEnd = true);
 
 		const auto& recorded_commands_and_sync_instructions() const { return mRecordedCommandsAndSyncInstructions; }
@@ -1226,49 +1633,164 @@ namespace avk
 		std::vector<any_owning_resource_t> mLifetimeHandledResources;
 	};
 
+	/**	Recorded commands which have been lowered into a flat stream of records that can be replayed
+	 *	into command buffers many times (see recorded_commands::and_compile).
+	 *
+	 *	Compiling resolves everything that does not depend on the command buffer once: Nested commands of
+	 *	action-type commands are flattened, and all synchronization commands are turned into ready-to-use
+	 *	barriers (including their auto_stage/auto_access inference). Replaying only iterates over the
+	 *	records, without any std::visit or recursion.
+	 *
+	 *	Parameters can be patched between replays through commands which read their data via pointers
+	 *	at the time of recording, such as command::push_constants(layout, const D*), command::draw(const vk::DrawIndirectCommand*),
+	 *	or command::dispatch(const vk::DispatchIndirectCommand*). The pointed-to data must stay alive as long as
+	 *	the compiled_commands are replayed.
+	 */
+	class compiled_commands final
+	{
+	public:
+		enum struct record_type : uint32_t
+		{
+			invoke,
+			memory_barrier,
+			image_memory_barrier,
+			buffer_memory_barrier,
+			barrier
+		};
+
+		struct record
+		{
+			record_type mType;
+			uint32_t mIndex;
+		};
+
+		compiled_commands() = default;
+		compiled_commands(const root* aRoot, std::vector<recorded_commands_t> aRecordedCommandsAndSyncInstructions, std::vector<any_owning_resource_t> aLifetimeHandledResources);
+		compiled_commands(const compiled_commands&) = delete;
+		compiled_commands(compiled_commands&&) noexcept = default;
+		compiled_commands& operator=(const compiled_commands&) = delete;
+		compiled_commands& operator=(compiled_commands&&) noexcept = default;
+		~compiled_commands() = default;
+
+		/**	Replay all the compiled commands into the given command buffer.
+		 *	Neither begin_recording() nor end_recording() are invoked on the command buffer.
+		 *	All resources which are lifetime-handled by this compiled_commands instance must stay alive
+		 *	until the command buffer has completed execution.
+		 */
+		void replay_into(avk::command_buffer_t& aCommandBuffer) const;
+
+		/** The number of records in the flat command stream */
+		auto num_records() const { return mRecords.size(); }
+
+		/** The number of pre-resolved barriers in the flat command stream */
+		auto num_barriers() const { return mDependencyInfos.size(); }
+
+	private:
+		void compile(std::span<const recorded_commands_t> aRecordedCommandsAndSyncInstructions);
+		void add_invoke(const std::function<void(avk::command_buffer_t&)>& aFun);
+
+		const root* mRoot = nullptr;
+		// Keeps all the recording functions alive, which the records refer to:
+		std::vector<recorded_commands_t> mRecordedCommandsAndSyncInstructions;
+		std::vector<record> mRecords;
+		std::vector<const std::function<void(avk::command_buffer_t&)>*> mFunctions;
+		std::vector<vk::MemoryBarrier2KHR> mMemoryBarriers;
+		std::vector<vk::ImageMemoryBarrier2KHR> mImageMemoryBarriers;
+		std::vector<vk::BufferMemoryBarrier2KHR> mBufferMemoryBarriers;
+		std::vector<vk::DependencyInfoKHR> mDependencyInfos;
+		std::vector<any_owning_resource_t> mLifetimeHandledResources;
+	};
+
 
 	// Some convenience functions:
 
 	namespace command
 	{
+		/**	A per-frame arena for lists of recorded commands.
+		 *	Lists which are created through an arena (see the overloads of gather, one_for_each, and many_for_each
+		 *	which take an arena as their first parameter) allocate their memory from a monotonic buffer, which
+		 *	is released as a whole by reset(). As long as a frame's lists fit into the initial buffer, no
+		 *	heap allocations are required for them at all.
+		 *
+		 *	Lists from an arena can also be passed as nested commands to render_pass and rendering, which take
+		 *	them over without copying. The resulting commands must then be recorded before the arena is reset, too.
+		 *
+		 *	Call reset() once per frame, after all lists which have been created through the arena have been
+		 *	recorded (see command_buffer_t::record) and destroyed.
+		 *	An arena is not thread-safe. Use one arena per recording thread.
+		 */
+		class arena
+		{
+		public:
+			/**	Create a new arena.
+			 *	@param	aInitialSizeInBytes		Size of the buffer which is reused every frame. Whatever does not fit into it,
+			 *									is allocated from the default memory resource until the next reset().
+			 */
+			arena(size_t aInitialSizeInBytes = 64 * 1024)
+				: mBuffer(std::max(aInitialSizeInBytes, size_t{ 1 }))
+				, mResource{ mBuffer.data(), mBuffer.size(), std::pmr::get_default_resource() }
+			{ }
+			arena(arena&&) = delete;
+			arena(const arena&) = delete;
+			arena& operator=(arena&&) = delete;
+			arena& operator=(const arena&) = delete;
+			~arena() = default;
+
+			/** The memory resource which all the lists of this arena allocate from. */
+			std::pmr::memory_resource* resource() { return &mResource; }
+
+			/** Create a new, empty list which allocates from this arena. */
+			avk::recorded_commands_arena_list make_list() { return avk::recorded_commands_arena_list{ resource() }; }
+
+			/**	Release all memory that has been allocated from this arena since the last reset.
+			 *	All lists which have been created through this arena must have been destroyed before.
+			 */
+			void reset() { mResource.release(); }
+
+		private:
+			std::vector<std::byte> mBuffer;
+			std::pmr::monotonic_buffer_resource mResource;
+		};
+
 		// End of recursive variadic template handling
-		inline static void add_commands(std::vector<avk::recorded_commands_t>&) { /* We're done here. */ }
+		template <typename A>
+		inline static void add_commands(std::vector<avk::recorded_commands_t, A>&) { /* We're done here. */ }
 
 		// Add a specific pipeline setting to the pipeline config
-		template <typename... Ts>
-		inline static void add_commands(std::vector<avk::recorded_commands_t>& aGatheredCommands, avk::command::state_type_command& aOneMoreCommand, Ts&... aRest)
+		template <typename A, typename... Ts>
+		inline static void add_commands(std::vector<avk::recorded_commands_t, A>& aGatheredCommands, avk::command::state_type_command& aOneMoreCommand, Ts&... aRest)
 		{
 			aGatheredCommands.push_back(std::move(aOneMoreCommand));
 			add_commands(aGatheredCommands, aRest...);
 		}
 
 		// Add a specific pipeline setting to the pipeline config
-		template <typename... Ts>
-		inline static void add_commands(std::vector<avk::recorded_commands_t>& aGatheredCommands, avk::command::action_type_command& aOneMoreCommand, Ts&... aRest)
+		template <typename A, typename... Ts>
+		inline static void add_commands(std::vector<avk::recorded_commands_t, A>& aGatheredCommands, avk::command::action_type_command& aOneMoreCommand, Ts&... aRest)
 		{
 			aGatheredCommands.push_back(std::move(aOneMoreCommand));
 			add_commands(aGatheredCommands, aRest...);
 		}
 
 		// Add a specific pipeline setting to the pipeline config
-		template <typename... Ts>
-		inline static void add_commands(std::vector<avk::recorded_commands_t>& aGatheredCommands, avk::sync::sync_type_command& aOneMoreCommand, Ts&... aRest)
+		template <typename A, typename... Ts>
+		inline static void add_commands(std::vector<avk::recorded_commands_t, A>& aGatheredCommands, avk::sync::sync_type_command& aOneMoreCommand, Ts&... aRest)
 		{
 			aGatheredCommands.push_back(std::move(aOneMoreCommand));
 			add_commands(aGatheredCommands, aRest...);
 		}
 
 		// Add a specific pipeline setting to the pipeline config
-		template <typename... Ts>
-		inline static void add_commands(std::vector<avk::recorded_commands_t>& aGatheredCommands, avk::recorded_commands_t& aOneMoreCommand, Ts&... aRest)
+		template <typename A, typename... Ts>
+		inline static void add_commands(std::vector<avk::recorded_commands_t, A>& aGatheredCommands, avk::recorded_commands_t& aOneMoreCommand, Ts&... aRest)
 		{
 			aGatheredCommands.push_back(std::move(aOneMoreCommand));
 			add_commands(aGatheredCommands, aRest...);
 		}
 
 		// Add a specific pipeline setting to the pipeline config
-		template <typename... Ts>
-		inline static void add_commands(std::vector<avk::recorded_commands_t>& aGatheredCommands, std::vector<avk::recorded_commands_t>& aManyMoreCommands, Ts&... aRest)
+		template <typename A, typename B, typename... Ts>
+		inline static void add_commands(std::vector<avk::recorded_commands_t, A>& aGatheredCommands, std::vector<avk::recorded_commands_t, B>& aManyMoreCommands, Ts&... aRest)
 		{
 			// Use std::insert with std::make_move_iterator as suggested here: https://stackoverflow.com/questions/15004517/moving-elements-from-stdvector-to-another-one
 			aGatheredCommands.insert(std::end(aGatheredCommands), std::make_move_iterator(std::begin(aManyMoreCommands)),
@@ -1291,6 +1813,19 @@ namespace avk
 			return result;
 		}
 
+		/**	Convenience function for gathering recorded commands into a list which is allocated from the given arena.
+		 *	Supports the same types as the gather overload without an arena, and additionally avk::recorded_commands_arena_list.
+		 *	@param	aArena		The (per-frame) arena to allocate the resulting list from
+		 */
+		template <typename... Ts>
+		inline static avk::recorded_commands_arena_list gather(arena& aArena, Ts... args)
+		{
+			auto result = aArena.make_list();
+			result.reserve(sizeof...(Ts));
+			add_commands(result, args...);
+			return result;
+		}
+
 		// TODO: Comment
 		template <typename T, typename F>
 		inline static std::vector<avk::recorded_commands_t> one_for_each(const T& aCollection, F aGenerator)
@@ -1302,6 +1837,24 @@ namespace avk
 			return result;
 		}
 
+		/**	Generates one command per element of aCollection, gathered in a list which is allocated from the given arena.
+		 *	@param	aArena			The (per-frame) arena to allocate the resulting list from
+		 *	@param	aCollection		The elements to generate commands for
+		 *	@param	aGenerator		Invoked for each element, must return one avk::recorded_commands_t (or something convertible to it)
+		 */
+		template <typename T, typename F>
+		inline static avk::recorded_commands_arena_list one_for_each(arena& aArena, const T& aCollection, F aGenerator)
+		{
+			auto result = aArena.make_list();
+			if constexpr (std::ranges::sized_range<const T>) {
+				result.reserve(std::ranges::size(aCollection));
+			}
+			for (const auto& element : aCollection) {
+				result.push_back(aGenerator(element));
+			}
+			return result;
+		}
+
 		// TODO: Comment
 		template <typename T, typename F>
 		inline static std::vector<avk::recorded_commands_t> many_for_each(const T& aCollection, F aGenerator)
@@ -1316,6 +1869,24 @@ namespace avk
 			return result;
 		}
 
+		/**	Generates multiple commands per element of aCollection, gathered in a list which is allocated from the given arena.
+		 *	@param	aArena			The (per-frame) arena to allocate the resulting list from
+		 *	@param	aCollection		The elements to generate commands for
+		 *	@param	aGenerator		Invoked for each element, must return a collection of avk::recorded_commands_t
+		 */
+		template <typename T, typename F>
+		inline static avk::recorded_commands_arena_list many_for_each(arena& aArena, const T& aCollection, F aGenerator)
+		{
+			auto result = aArena.make_list();
+			for (const auto& element : aCollection) {
+				auto commands = aGenerator(element);
+				for (auto& command : commands) {
+					result.push_back(std::move(command));
+				}
+			}
+			return result;
+		}
+
 		// TODO: Comment
 		template <typename C, typename F1>
 		inline static avk::recorded_commands_t conditional(C aCondition, F1 aPositive)
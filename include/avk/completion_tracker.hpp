@@ -0,0 +1,81 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Tracks the completion of submissions without blocking, and recycles the fences which are used for that.
+	 *
+	 *	track() makes a submission signal a fence which is taken from a pool of recycled fences (new fences are
+	 *	only created if the pool is empty). poll() checks the status of all the tracked fences without blocking.
+	 *	For every completed submission, it
+	 *	 - invokes the post execution handler of the submitted command buffer,
+	 *	 - invokes the completion handler that has been passed to track(),
+	 *	 - destroys the resources whose lifetimes are handled by the command buffer or have been passed to track(),
+	 *	 - resets the fence and returns it to the pool.
+	 *	Completed submissions are processed in the order in which they have been tracked.
+	 *	If a handler throws, the submission is handled nonetheless, as are all the other completed submissions;
+	 *	the first exception is rethrown by poll() or wait_idle() afterwards.
+	 *
+	 *	track() and poll() may be invoked from different threads. Handlers are invoked on the thread that invokes poll().
+	 */
+	class completion_tracker_t
+	{
+		friend class root;
+
+	public:
+		completion_tracker_t() = default;
+		completion_tracker_t(completion_tracker_t&&) noexcept = default;
+		completion_tracker_t(const completion_tracker_t&) = delete;
+		completion_tracker_t& operator=(completion_tracker_t&&) noexcept = default;
+		completion_tracker_t& operator=(const completion_tracker_t&) = delete;
+		~completion_tracker_t() = default;
+
+		/**	Track the completion of the given submission. It must be invoked before the submission is submitted.
+		 *	@param	aSubmission				The submission to be tracked. It must not signal a fence already.
+		 *									Its command buffer must stay alive until the submission has completed,
+		 *									unless it has been passed as owning resource.
+		 *	@param	aCompletionHandler		Invoked by poll() after the submission has completed.
+		 *	@param	aResourcesToRelease		Resources which are destroyed after the submission has completed.
+		 *	@return	The submission, with a fence to be signaled set.
+		 */
+		submission_data& track(submission_data& aSubmission, std::function<void()> aCompletionHandler = {}, std::vector<any_owning_resource_t> aResourcesToRelease = {});
+
+		/**	Check all the tracked submissions for completion without blocking,
+		 *	and handle completed ones as described in the class' documentation.
+		 *	@return	The number of submissions which have been found to be completed.
+		 */
+		size_t poll();
+
+		/** Block until all the tracked submissions have completed, and handle them. */
+		void wait_idle();
+
+		/** The number of tracked submissions which have not been handled as completed yet */
+		size_t num_pending() const;
+		/** The number of fences which are currently available for reuse */
+		size_t num_pooled_fences() const;
+
+		/** Take an unsignaled fence from the pool of recycled fences, or create a new one if the pool is empty. */
+		fence acquire_fence();
+		/** Reset the given fence, which must not be in use anymore, and return it to the pool. */
+		void recycle_fence(fence aFence);
+
+	private:
+		struct pending_submission
+		{
+			fence mFence;
+			std::optional<avk::resource_argument<avk::command_buffer_t>> mCommandBuffer;
+			std::function<void()> mCompletionHandler;
+			std::vector<any_owning_resource_t> mResourcesToRelease;
+		};
+
+		// Handle the given completed submission and return its fence to the pool:
+		void complete(pending_submission& aCompleted);
+
+		const root* mRoot = nullptr;
+		std::unique_ptr<std::mutex> mMutex;
+		std::vector<pending_submission> mPendingSubmissions;
+		std::vector<fence> mAvailableFences;
+	};
+
+	using completion_tracker = owning_resource<completion_tracker_t>;
+}
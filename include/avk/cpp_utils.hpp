@@ -827,6 +827,22 @@ namespace avk
 		(hash_combine(seed, rest), ...);
 	}
 
+	/*	Mixes a 64-bit value into a running 64-bit hash value, using the multiply-xorshift finalizer of splitmix64,
+	 *  which is of similar quality as the mixing steps of wyhash or xxh3, but does not require 128-bit multiplication.
+	 *  In contrast to hash_combine, all bits of the result depend on all bits of the inputs, which makes it
+	 *  suitable for hashing larger amounts of data, such as all the handles of a descriptor set, without collisions.
+	 */
+	inline uint64_t hash_mix(uint64_t aHash, uint64_t aValue) noexcept
+	{
+		aHash ^= aValue + 0x9e3779b97f4a7c15ull + (aHash << 6) + (aHash >> 2);
+		aHash ^= aHash >> 30;
+		aHash *= 0xbf58476d1ce4e5b9ull;
+		aHash ^= aHash >> 27;
+		aHash *= 0x94d049bb133111ebull;
+		aHash ^= aHash >> 31;
+		return aHash;
+	}
+
 	/**	Returns true if `aElement` is contained within `aContainer`, also provides
 	 *	the option to return the position where the element has been found.
 	 *	@param	aContainer		The container to search `aElement` in.
@@ -0,0 +1,17 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/** How descriptors are stored and bound, see root::descriptor_backend_in_use */
+	enum struct descriptor_backend
+	{
+		/** Descriptor sets are allocated from descriptor pools and bound with vkCmdBindDescriptorSets (the default). */
+		descriptor_sets,
+
+		/** Descriptors are written directly into a host-visible buffer and bound with vkCmdBindDescriptorBuffersEXT and
+		 *	vkCmdSetDescriptorBufferOffsetsEXT. Requires VK_EXT_descriptor_buffer and buffer device addresses.
+		 *	Push descriptor sets, update-after-bind layouts, and bindless_heap are not supported with this backend. */
+		descriptor_buffer
+	};
+}
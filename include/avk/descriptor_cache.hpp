@@ -4,11 +4,13 @@
 namespace avk
 {
 	/**	This is a ready-to-use implementation for a descriptor cache.
-	 *  The cache is prepared for concurrent access from multiple threads
+	 *  All of its methods can be invoked from multiple threads concurrently,
 	 *  and it will create one or multiple descriptor pools per thread.
 	 *
 	 *  Descriptor pools are not shared across threads, but always exclusive
-	 *  for a certain thread.
+	 *  for a certain thread. Cached descriptor sets are distributed over several
+	 *  shards, each guarded by its own reader-writer lock, so that concurrent
+	 *  cache hits only take shared locks and rarely contend with each other.
 	 *
 	 *  The allocated pools are rather tightly sized and fit to incoming requests.
 	 *  This might or might not be the desired behavior. If the descriptors that
@@ -25,14 +27,69 @@ namespace avk
 	 *  of this descriptor_cache, consider implementing a different descriptor
 	 *  cache class or in general, handle it manually.
 	 *
+	 *  By default, the cache grows unboundedly. If a capacity is set with set_capacity(),
+	 *  begin_frame() evicts the least recently used sets which exceed the capacity, but only
+	 *  those which have not been used by any of the frames that might still be in flight.
+	 *  Descriptor sets returned by the cache must therefore not be kept across frames, but
+	 *  requested again every frame. Sets which are evicted or removed (see remove_sets_with_handle)
+	 *  are freed individually by the first begin_frame() after the frames which might still use them,
+	 *  so that their space can be reused without waiting for the rest of their pool. Pools which no
+	 *  longer hold any sets are reset, and destroyed if they are still not used after another
+	 *  number_of_frames_in_flight() frames. This also reclaims the pools of threads which no longer
+	 *  allocate new sets. Without calls to begin_frame(), removed sets are not freed at all.
+	 *
+	 *  If the root selects avk::descriptor_backend::descriptor_buffer, no pools are used at all.
+	 *  Instead, the descriptors of new sets are written into one host-visible descriptor buffer
+	 *  of descriptor_buffer_size() bytes, which is created upon the first allocation.
+	 *  Space in the descriptor buffer is not reclaimed when sets are removed from the cache.
+	 *  Therefore, begin_frame() does not evict any sets in this mode: an evicted set which is
+	 *  requested again would only occupy additional space in the descriptor buffer.
 	 */
 	class descriptor_cache_t
 	{
 		friend class root;
 		
 	public:
+		/** Counters of a descriptor cache's activity since its creation */
+		struct cache_statistics
+		{
+			/** The number of lookups which found the descriptor set in the cache */
+			uint64_t mHits;
+			/** The number of lookups which did not find the descriptor set in the cache */
+			uint64_t mMisses;
+			/** The number of descriptor sets which have been evicted by begin_frame() */
+			uint64_t mEvictions;
+			/** The number of descriptor pools which have been reset for reuse */
+			uint64_t mPoolResets;
+		};
+
 		auto prealloc_factor() const { return mPreallocFactor; }
 		void set_prealloc_factor(int aFactor) { mPreallocFactor = aFactor; }
+		auto descriptor_buffer_size() const { return mDescriptorBufferSize; }
+		/** Set the size of the descriptor buffer for the descriptor_buffer backend. Must be set before the first allocation. */
+		void set_descriptor_buffer_size(vk::DeviceSize aSize) { mDescriptorBufferSize = aSize; }
+		auto capacity() const { return mCapacity; }
+		auto number_of_frames_in_flight() const { return mNumFramesInFlight; }
+		/**	Limit the number of descriptor sets in the cache. Must be set before concurrent use.
+		 *	The capacity is ignored under the descriptor_buffer backend, which cannot reclaim the space of evicted sets.
+		 *	@param	aMaxNumSets				The maximum number of cached sets after begin_frame(); 0 means unlimited
+		 *	@param	aNumFramesInFlight		Sets which have been used by one of that many most recent frames are never evicted,
+		 *									and empty pools are only reset after that many frames
+		 */
+		void set_capacity(size_t aMaxNumSets, uint32_t aNumFramesInFlight);
+
+		/**	Signal the beginning of a new frame. If a capacity is set, the least recently used sets are evicted until
+		 *	the capacity is met, or until only sets remain which might still be used by frames in flight.
+		 *	Afterwards, evicted and removed sets which no frame in flight uses anymore are freed, and pools which
+		 *	do not hold any sets are reset or destroyed, for all threads.
+		 *	@param	aFrameId	Index of the current frame, which must increase monotonically
+		 */
+		void begin_frame(int64_t aFrameId);
+
+		/** The number of descriptor sets which are currently in the cache */
+		size_t number_of_cached_sets() const;
+		/** Hit, miss, eviction, and pool reset counters */
+		cache_statistics statistics() const;
 		
 		const descriptor_set_layout& get_or_alloc_layout(descriptor_set_layout aPreparedLayout);
 		std::optional<descriptor_set> get_descriptor_set_from_cache(const descriptor_set& aPreparedSet);
@@ -52,15 +109,139 @@ namespace avk
 		std::string mName = "descriptor cache";
 		int mPreallocFactor = 5;
 		const root* mRoot;
-		
-		std::unordered_set<descriptor_set_layout> mLayouts;
-		std::unordered_set<descriptor_set> mSets;
-		
+
+		// The number of shards which the cached descriptor sets are distributed over:
+		static constexpr size_t sNumSetShards = 16;
+
+		// Per cached set; the frame-id is updated on every hit, under a shared lock:
+		struct cached_set_info
+		{
+			std::atomic<int64_t> mLastUsedFrame = 0;
+		};
+
+		// The kinds of resource handles which cached sets can be looked up by, see remove_sets_with_handle:
+		enum struct handle_kind
+		{
+			image_view,
+			buffer,
+			sampler,
+			buffer_view
+		};
+
+		// Identifies a cached set by the bindings which it would be prepared from, so that cache hits need not prepare a set:
+		struct bindings_key
+		{
+			std::size_t mHash;
+			const binding_data* mBegin;
+			const binding_data* mEnd;
+		};
+
+		struct set_hash
+		{
+			using is_transparent = void;
+			std::size_t operator()(const descriptor_set& aSet) const noexcept { return aSet.hash(); }
+			std::size_t operator()(const bindings_key& aKey) const noexcept { return aKey.mHash; }
+		};
+
+		struct set_equal
+		{
+			using is_transparent = void;
+			bool operator()(const descriptor_set& aLeft, const descriptor_set& aRight) const { return aLeft == aRight; }
+			bool operator()(const bindings_key& aKey, const descriptor_set& aSet) const { return aKey.mHash == aSet.hash() && aSet.has_contents_of(aKey.mBegin, aKey.mEnd); }
+			bool operator()(const descriptor_set& aSet, const bindings_key& aKey) const { return (*this)(aKey, aSet); }
+		};
+
+		using set_map = std::unordered_map<descriptor_set, cached_set_info, set_hash, set_equal>;
+
+		struct set_shard
+		{
+			std::shared_mutex mMutex;
+			set_map mSets;
+			// Reverse index from resource handles to the cached sets (i.e., keys of mSets) which refer to them, per handle_kind:
+			std::array<std::unordered_multimap<uint64_t, const descriptor_set*>, 4> mSetsByHandle;
+			// Counted per shard, so that threads which hit different shards do not contend for the same counter:
+			std::atomic<uint64_t> mNumHits = 0;
+			std::atomic<uint64_t> mNumMisses = 0;
+		};
+
+		// A pool together with the capacities it is handed out with, which are restored when it is reset:
+		struct pool_entry
+		{
+			std::shared_ptr<descriptor_pool> mPool;
+			std::vector<vk::DescriptorPoolSize> mCapacities;
+			// The frame in which the pool has been found without any sets referring to it:
+			std::optional<int64_t> mEmptySinceFrame;
+		};
+
 		// Descriptor pools are created/stored per thread and can have a name (an integer-id). 
 		// If possible, it is tried to re-use a pool. Even when re-using a pool, it might happen that
 		// allocating from it might fail (because out of memory, for instance). In such cases, a new 
-		// pool will be created.
-		std::unordered_map<std::thread::id, std::vector<std::weak_ptr<descriptor_pool>>> mDescriptorPools;
+		// pool will be created. The owning thread accesses its list of pools under a shared lock of
+		// mDescriptorPoolsMutex; only begin_frame() accesses all of them, under an exclusive lock.
+		using thread_pools = std::vector<pool_entry>;
+
+		// A set which has been removed from the cache, and is freed once no frame in flight can use it anymore:
+		struct retired_set
+		{
+			descriptor_set mSet;
+			int64_t mLastUsedFrame;
+		};
+
+		// Everything which is shared between threads is stored in here, so that the cache stays movable:
+		struct state
+		{
+			std::shared_mutex mLayoutsMutex;
+			std::unordered_set<descriptor_set_layout> mLayouts;
+			std::array<set_shard, sNumSetShards> mSetShards;
+			std::shared_mutex mDescriptorPoolsMutex;
+			std::unordered_map<std::thread::id, std::unique_ptr<thread_pools>> mDescriptorPools;
+			std::mutex mDescriptorBufferMutex;
+			std::atomic<int64_t> mCurrentFrameId = 0;
+			// Only once begin_frame() is called, the frames in flight are known, and removed sets can be freed safely:
+			std::atomic<bool> mTracksFrames = false;
+			std::mutex mRetiredSetsMutex;
+			std::vector<retired_set> mRetiredSets;
+			std::atomic<uint64_t> mNumEvictions = 0;
+			std::atomic<uint64_t> mNumPoolResets = 0;
+		};
+
+		// Use the high bits of the hash for the shard, so that it does not correlate with the bucket within the shard:
+		set_shard& shard_for(std::size_t aHash) const { return mState->mSetShards[(aHash >> (std::numeric_limits<std::size_t>::digits - 8)) % sNumSetShards]; }
+		std::tuple<std::shared_lock<std::shared_mutex>, thread_pools&> lock_pools_of_this_thread();
+		std::shared_ptr<descriptor_pool> get_descriptor_pool_for_layouts(thread_pools& aPools, const descriptor_alloc_request& aAllocRequest, bool aRequestNewPool);
+		void evict_least_recently_used_sets(int64_t aFrameId);
+		void free_retired_sets_and_sweep_pools(int64_t aFrameId);
+		std::optional<descriptor_set> find_in_cache(const descriptor_set& aPreparedSet);
+		std::optional<descriptor_set> find_in_cache(const binding_data* aBegin, const binding_data* aEnd);
+		descriptor_set insert_into_cache(descriptor_set aSet);
+		template <typename H>
+		static uint64_t handle_key(H aHandle) { return reinterpret_cast<uint64_t>(static_cast<typename H::CType>(aHandle)); }
+		template <typename F>
+		static void for_each_referenced_handle(const descriptor_set& aSet, F aFunc);
+		static void add_to_reverse_index(set_shard& aShard, const descriptor_set& aSet);
+		set_map::iterator erase_from_shard(set_shard& aShard, set_map::iterator aIt);
+		int remove_sets_with_handle(handle_kind aKind, uint64_t aHandleKey);
+
+#if VK_HEADER_VERSION >= 235
+		// The descriptor buffer which sets are written into, if the descriptor_buffer backend is in use:
+		struct descriptor_buffer_storage
+		{
+			avk::buffer mBuffer;
+			std::optional<scoped_mapping<AVK_MEM_BUFFER_HANDLE>> mMapping;
+			vk::DeviceSize mNextOffset = 0;
+			vk::PhysicalDeviceDescriptorBufferPropertiesEXT mProperties;
+		};
+
+		std::vector<descriptor_set> write_new_descriptor_sets_into_descriptor_buffer(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts, std::vector<descriptor_set> aPreparedSets);
+		static size_t descriptor_buffer_descriptor_size(const vk::PhysicalDeviceDescriptorBufferPropertiesEXT& aProperties, vk::DescriptorType aType);
+		void write_descriptor_into_descriptor_buffer(const vk::WriteDescriptorSet& aWrite, uint32_t aElement, void* aDst, size_t aDescriptorSize) const;
+		std::unique_ptr<descriptor_buffer_storage> mDescriptorBufferStorage;
+#endif
+		vk::DeviceSize mDescriptorBufferSize = 4 * 1024 * 1024;
+		size_t mCapacity = 0;
+		uint32_t mNumFramesInFlight = 1;
+
+		std::unique_ptr<state> mState;
 	};
 
 	using descriptor_cache = owning_resource<descriptor_cache_t>;
@@ -28,6 +28,13 @@ namespace avk
 		
 		std::vector<vk::DescriptorSet> allocate(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts);
 
+		/**	Frees the given descriptor sets, which must have been allocated from this pool, and adds their sizes to the
+		 *	remaining capacities. The pool must have been created with vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet.
+		 *	@param	aSets		The descriptor sets to be freed
+		 *	@param	aSizes		The accumulated descriptor counts per type of all the given sets
+		 */
+		void free(const std::vector<vk::DescriptorSet>& aSets, const std::vector<vk::DescriptorPoolSize>& aSizes);
+
 		/**	Resets this descriptor pool, freeing all descriptor sets that have been allocated from it.
 		 *	Also sets remaining capacities to initial capacities.
 		 *	Use at your own risk!
@@ -3,6 +3,8 @@
 
 namespace avk
 {
+	class descriptor_set_layout;
+
 	/** Descriptor set */
 	class descriptor_set
 	{
@@ -20,10 +22,46 @@ namespace avk
 
 		auto number_of_writes() const { return mOrderedDescriptorDataWrites.size(); }
 		const auto& write_at(size_t i) const { return mOrderedDescriptorDataWrites[i]; }
+		const auto* writes_data_ptr() const { return mOrderedDescriptorDataWrites.data(); }
+		/** The number of dynamic uniform/storage buffer descriptors, i.e., how many dynamic offsets must be passed when binding this set */
+		auto number_of_dynamic_offsets() const { return mNumDynamicOffsets; }
 		const auto* pool() const { return static_cast<bool>(mPool) ? mPool.get() : nullptr; }
 		auto handle() const { return mDescriptorSet; }
+		/** True if the descriptors of this set have been written into a descriptor buffer (see avk::descriptor_backend::descriptor_buffer) */
+		bool is_in_descriptor_buffer() const { return mDescriptorBufferOffset.has_value(); }
+		/** The device address of the descriptor buffer which this set's descriptors have been written into */
+		auto descriptor_buffer_address() const { return mDescriptorBufferAddress; }
+		/** The offset of this set's descriptors into the descriptor buffer */
+		auto descriptor_buffer_offset() const { return mDescriptorBufferOffset.value(); }
 		auto set_id() const { return mSetId; }
 		void set_set_id(uint32_t aNewSetId) { mSetId = aNewSetId; }
+		/** The hash value of all the descriptors of this set, which has been computed when the set was prepared */
+		auto hash() const { return mHash; }
+		/**	The hash value which a set prepared from the given bindings would have, computed without preparing it.
+		 *	The bindings must all refer to the same set-id and be ordered.
+		 */
+		static std::size_t hash_of(const binding_data* aBegin, const binding_data* aEnd);
+		/**	True if this set has exactly the descriptors which a set prepared from the given bindings would have.
+		 *	The bindings must all refer to the same set-id and be ordered.
+		 */
+		bool has_contents_of(const binding_data* aBegin, const binding_data* aEnd) const;
+
+		/**	A copy which only refers to the allocated set (or its place in the descriptor buffer), but not to the
+		 *	descriptors it has been written with. It is cheap to create, since it does not allocate any memory,
+		 *	and it can be bound like this set, but it can neither be written nor compared to other sets.
+		 */
+		descriptor_set reference_copy() const
+		{
+			descriptor_set result;
+			result.mPool = mPool;
+			result.mDescriptorSet = mDescriptorSet;
+			result.mDescriptorBufferAddress = mDescriptorBufferAddress;
+			result.mDescriptorBufferOffset = mDescriptorBufferOffset;
+			result.mSetId = mSetId;
+			result.mHash = mHash;
+			result.mNumDynamicOffsets = mNumDynamicOffsets;
+			return result;
+		}
 
 		const auto* store_image_infos(uint32_t aBindingId, std::vector<vk::DescriptorImageInfo> aStoredImageInfos)
 		{
@@ -124,23 +162,52 @@ namespace avk
 					b.texel_buffer_view_info(result)
 				);
 				result.mOrderedDescriptorDataWrites.back().setPNext(b.next_pointer(result));
+				if (vk::DescriptorType::eUniformBufferDynamic == b.mLayoutBinding.descriptorType || vk::DescriptorType::eStorageBufferDynamic == b.mLayoutBinding.descriptorType) {
+					result.mNumDynamicOffsets += b.descriptor_count();
+				}
 				
 				++it;
 			}
 
 			result.update_data_pointers();
+			result.mHash = result.compute_hash();
 			return result;
 		}
 
+		/**	Prepare a descriptor set from the given bindings, which must all refer to the same set-id.
+		 *	In contrast to the iterator-based overload, the bindings need not be ordered.
+		 */
+		static descriptor_set prepare(std::vector<binding_data> aBindings);
+
 		void link_to_handle_and_pool(vk::DescriptorSet aHandle, std::shared_ptr<descriptor_pool> aPool);
+		/**	Frees this set in the pool which it has been allocated from, and unlinks it from the pool.
+		 *	The pool must have been created with vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet, and must not be
+		 *	accessed concurrently. No copy of this set must be used afterwards.
+		 */
+		void free_from_pool();
+		void link_to_descriptor_buffer(vk::DeviceAddress aBufferAddress, vk::DeviceSize aOffset);
 		void write_descriptors();
+		/**	Write the descriptors through the layout's descriptor update template, which packs all the
+		 *	descriptor data into one contiguous blob. Falls back to write_descriptors() if the layout has no template.
+		 */
+		void write_descriptors(const descriptor_set_layout& aLayout);
 		
 	private:
+		// Hashes the full contents of all the writes, i.e., every element of every array:
+		std::size_t compute_hash() const;
+		// Invokes aFunc with each descriptor's image info, buffer info, buffer view, or acceleration structure handle:
+		template <typename F>
+		static void for_each_descriptor_of(const binding_data& aBinding, F aFunc);
+
 		std::vector<vk::WriteDescriptorSet> mOrderedDescriptorDataWrites;
 		std::shared_ptr<descriptor_pool> mPool;
 		vk::DescriptorSet mDescriptorSet;
+		vk::DeviceAddress mDescriptorBufferAddress = 0;
+		std::optional<vk::DeviceSize> mDescriptorBufferOffset;
 		// TODO: Are there cases where vk::UniqueDescriptorSet would be beneficial? Right now, the pool cleans up all the descriptor sets.
 		uint32_t mSetId;
+		std::size_t mHash = 0;
+		uint32_t mNumDynamicOffsets = 0u;
 		// TODO: Probably turn all of these vectors into shared_ptrs which is much better when passing around between descriptor_cache and bind_descriptors, etc.!
 		std::vector<std::tuple<uint32_t, std::vector<vk::DescriptorImageInfo>>> mStoredImageInfos;
 		std::vector<std::tuple<uint32_t, std::vector<vk::DescriptorBufferInfo>>> mStoredBufferInfos;
@@ -161,38 +228,8 @@ namespace std
 	{
 		std::size_t operator()(avk::descriptor_set const& o) const noexcept
 		{
-			std::size_t h = 0;
-			for(auto& w : o.mOrderedDescriptorDataWrites)
-			{
-				avk::hash_combine(h, w.dstBinding, w.dstArrayElement, w.descriptorCount, w.descriptorType);
-				// Dont compute a too expensive hash => only take the first elements, each:
-				if (nullptr != w.pImageInfo && w.descriptorCount > 0) {
-					avk::hash_combine(h, static_cast<VkSampler>(w.pImageInfo[0].sampler), static_cast<VkImageView>(w.pImageInfo[0].imageView), static_cast<VkImageLayout>(w.pImageInfo[0].imageLayout));
-				}
-				if (nullptr != w.pBufferInfo && w.descriptorCount > 0) {
-					avk::hash_combine(h, static_cast<VkBuffer>(w.pBufferInfo[0].buffer), w.pBufferInfo[0].offset, w.pBufferInfo[0].range);
-				}
-				if (nullptr != w.pTexelBufferView && w.descriptorCount > 0) {
-					avk::hash_combine(h, static_cast<VkBufferView>(w.pTexelBufferView[0]));
-				}
-
-#if VK_HEADER_VERSION >= 135
-				if (nullptr != w.pNext) {
-					if (w.descriptorType == vk::DescriptorType::eAccelerationStructureKHR) {
-						const auto* asInfo = reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(w.pNext);
-						avk::hash_combine(h, asInfo->accelerationStructureCount);
-						if (asInfo->accelerationStructureCount > 0) {
-							avk::hash_combine(h, static_cast<VkAccelerationStructureKHR>(asInfo->pAccelerationStructures[0]));
-						}
-					}
-					else {
-						avk::hash_combine(h, nullptr != w.pNext);
-					}
-				}
-#endif
-				// operator== will test for exact equality.
-			}
-			return h;
+			// Computed once when the set has been prepared; operator== will test for exact equality.
+			return o.hash();
 		}
 	};
 
@@ -31,6 +31,26 @@ namespace avk
 		auto number_of_bindings() const { return mOrderedBindings.size(); }
 		const auto& binding_at(size_t i) const { return mOrderedBindings[i]; }
 		auto* bindings_data_ptr() const { return mOrderedBindings.data(); }
+		auto create_flags() const { return mCreateFlags; }
+		/** True if this layout is intended for push descriptors, see command::push_descriptors */
+		bool is_for_push_descriptors() const { return static_cast<bool>(mCreateFlags & vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR); }
+		/** Set create flags, e.g., vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR. Must be set before the layout is allocated. */
+		void set_create_flags(vk::DescriptorSetLayoutCreateFlags aFlags) { assert(!mLayout); mCreateFlags = aFlags; }
+		/** The flags of each binding, in binding order; empty if no binding flags are set */
+		const auto& binding_flags() const { return mBindingFlags; }
+		/** Set flags for each binding (in binding order), e.g., for update-after-bind. Must be set before the layout is allocated. */
+		void set_binding_flags(std::vector<vk::DescriptorBindingFlags> aFlags) { assert(!mLayout); mBindingFlags = std::move(aFlags); }
+		/** True if descriptor sets of this layout can be written through a descriptor update template */
+		auto has_update_template() const { return static_cast<bool>(mUpdateTemplate); }
+		auto update_template_handle() const { return mUpdateTemplate.get(); }
+		/** The update template's entries, ordered by binding. Their offsets refer to a blob of update_template_data_size() bytes. */
+		const auto& update_template_entries() const { return mUpdateTemplateEntries; }
+		auto update_template_data_size() const { return mUpdateTemplateDataSize; }
+
+		/**	The size of one element of descriptor data (e.g., a vk::DescriptorImageInfo) for the given
+		 *	descriptor type, or 0 if the type cannot be written through a descriptor update template.
+		 */
+		static size_t descriptor_data_size(vk::DescriptorType aType);
 		auto owner() const { return mLayout.getOwner(); }
 		auto has_handle() const { return static_cast<bool>(mLayout); }
 		auto handle() const { return mLayout.get(); }
@@ -87,7 +107,12 @@ namespace avk
 	private:
 		std::vector<vk::DescriptorPoolSize> mBindingRequirements;
 		std::vector<vk::DescriptorSetLayoutBinding> mOrderedBindings;
+		vk::DescriptorSetLayoutCreateFlags mCreateFlags;
+		std::vector<vk::DescriptorBindingFlags> mBindingFlags;
 		vk::UniqueHandle<vk::DescriptorSetLayout, DISPATCH_LOADER_CORE_TYPE> mLayout;
+		std::vector<vk::DescriptorUpdateTemplateEntry> mUpdateTemplateEntries;
+		size_t mUpdateTemplateDataSize = 0;
+		vk::UniqueHandle<vk::DescriptorUpdateTemplate, DISPATCH_LOADER_CORE_TYPE> mUpdateTemplate;
 	};
 
 	extern bool operator ==(const descriptor_set_layout& left, const descriptor_set_layout& right);
@@ -102,6 +127,11 @@ namespace std
 		std::size_t operator()(avk::descriptor_set_layout const& o) const noexcept
 		{
 			std::size_t h = 0;
+			avk::hash_combine(h, static_cast<VkDescriptorSetLayoutCreateFlags>(o.mCreateFlags));
+			for(auto& flags : o.mBindingFlags)
+			{
+				avk::hash_combine(h, static_cast<VkDescriptorBindingFlags>(flags));
+			}
 			for(auto& binding : o.mOrderedBindings)
 			{
 				avk::hash_combine(h, binding.binding, binding.descriptorType, binding.descriptorCount, static_cast<VkShaderStageFlags>(binding.stageFlags), binding.pImmutableSamplers);
@@ -40,10 +40,23 @@ namespace avk
 		const auto* handle_ptr() const { return &mFence.get(); }
 
 		void wait_until_signalled(std::optional<uint64_t> aTimeout = {}) const;
+		/** Query the status of this fence without blocking. */
+		bool is_signalled() const;
+
+		/**	Export the payload of this fence as sync file descriptor through VK_KHR_external_fence_fd.
+		 *	The fence must have been created via root::create_fence_for_export, it must be signalled or have
+		 *	a pending signal operation, and exporting resets it. The returned file descriptor becomes readable
+		 *	(e.g., for poll or epoll) once the fence's signal operation has completed, and it must be closed by the caller.
+		 *	A value of -1 means that the fence had already been signalled.
+		 *	@param	aDispatchLoader		The extensions dispatch loader, e.g., root::dispatch_loader_ext()
+		 */
+		int export_sync_fd(const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader) const;
 		void reset();
 
 	private:
 		vk::FenceCreateInfo mCreateInfo;
+		// The handle types this fence can be exported as, which are chained to mCreateInfo if set:
+		vk::ExportFenceCreateInfo mExportCreateInfo;
 		vk::UniqueHandle<vk::Fence, DISPATCH_LOADER_CORE_TYPE> mFence;
 
 		// --- Some advanced features of a fence object ---
@@ -20,6 +20,10 @@ namespace avk
 		[[nodiscard]] const avk::renderpass_t& renderpass_reference() const { return mRenderPass.get(); }
 		auto renderpass_handle() const { return mRenderPass->handle(); }
 		auto subpass_id() const { return mSubpassIndex; }
+		/** True if this pipeline has been created for dynamic rendering, i.e., without a renderpass */
+		bool is_for_dynamic_rendering() const { return mDynamicRendering.has_value(); }
+		/** The dynamic rendering config, which is only set if this pipeline has been created for dynamic rendering */
+		const auto& dynamic_rendering_config() const { return mDynamicRendering; }
 		auto& vertex_input_binding_descriptions() { return mOrderedVertexInputBindingDescriptions; }
 		auto& vertex_input_attribute_descriptions() { return mVertexInputAttributeDescriptions; }
 		auto& vertex_input_state_create_info() { return mPipelineVertexInputStateCreateInfo; }
@@ -42,6 +46,7 @@ namespace avk
 		auto& layout_create_info() { return mPipelineLayoutCreateInfo; }
 		auto& tessellation_state_create_info() { return mPipelineTessellationStateCreateInfo; }
 		auto& create_flags() { return mPipelineCreateFlags; }
+		auto& rendering_create_info() { return mRenderingCreateInfo; }
 		const auto& vertex_input_binding_descriptions() const { return mOrderedVertexInputBindingDescriptions; }
 		const auto& vertex_input_attribute_descriptions() const { return mVertexInputAttributeDescriptions; }
 		const auto& vertex_input_state_create_info() const { return mPipelineVertexInputStateCreateInfo; }
@@ -64,6 +69,7 @@ namespace avk
 		const auto& layout_create_info() const { return mPipelineLayoutCreateInfo; }
 		const auto& tessellation_state_create_info() const { return mPipelineTessellationStateCreateInfo; }
 		const auto& create_flags() const { return mPipelineCreateFlags; }
+		const auto& rendering_create_info() const { return mRenderingCreateInfo; }
 		const auto& layout_handle() const { return mPipelineLayout.get(); }
 		std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> layout() const { return std::make_tuple(this, layout_handle(), &mPushConstantRanges); }
 		const auto& handle() const { return mPipeline.get(); }
@@ -71,6 +77,9 @@ namespace avk
 	private:
 		avk::renderpass mRenderPass;
 		uint32_t mSubpassIndex;
+		// Attachment formats for dynamic rendering, which is used instead of mRenderPass if set:
+		std::optional<cfg::dynamic_rendering> mDynamicRendering;
+		vk::PipelineRenderingCreateInfoKHR mRenderingCreateInfo;
 		// The vertex input data:
 		std::vector<vk::VertexInputBindingDescription> mOrderedVertexInputBindingDescriptions;
 		std::vector<vk::VertexInputAttributeDescription> mVertexInputAttributeDescriptions;
@@ -37,6 +37,53 @@ namespace avk
 			return a = a & b;
 		}
 
+		/** Pipeline configuration data: State which shall not be baked into the pipeline, but which shall
+		 *	be set dynamically with the according avk::command::set_* commands, so that one pipeline can be
+		 *	used for many permutations of that state. The according config entries are ignored.
+		 *	Requires VK_EXT_extended_dynamic_state, VK_EXT_extended_dynamic_state2, or VK_EXT_extended_dynamic_state3,
+		 *	respectively (see the comments of the values).
+		 */
+		enum struct dynamic_state
+		{
+			nothing					= 0x0000,
+			culling_mode			= 0x0001, // VK_EXT_extended_dynamic_state, set with command::set_culling_mode
+			front_face				= 0x0002, // VK_EXT_extended_dynamic_state, set with command::set_front_face
+			primitive_topology		= 0x0004, // VK_EXT_extended_dynamic_state, set with command::set_primitive_topology (only within the same topology class)
+			depth_test				= 0x0008, // VK_EXT_extended_dynamic_state, set with command::set_depth_test
+			depth_write				= 0x0010, // VK_EXT_extended_dynamic_state, set with command::set_depth_write
+			depth_bounds_test		= 0x0020, // VK_EXT_extended_dynamic_state, set with command::set_depth_bounds_test
+			stencil_test			= 0x0040, // VK_EXT_extended_dynamic_state, set with command::set_stencil_test
+			rasterizer_geometry_mode= 0x0080, // VK_EXT_extended_dynamic_state2, set with command::set_rasterizer_geometry_mode
+			depth_bias				= 0x0100, // VK_EXT_extended_dynamic_state2, set with command::set_depth_bias_enabled
+			primitive_restart		= 0x0200, // VK_EXT_extended_dynamic_state2, set with command::set_primitive_restart_enabled
+			polygon_drawing_mode	= 0x0400, // VK_EXT_extended_dynamic_state3, set with command::set_polygon_drawing_mode
+			depth_clamp				= 0x0800, // VK_EXT_extended_dynamic_state3, set with command::set_depth_clamp_enabled
+			color_blending_enabled	= 0x1000, // VK_EXT_extended_dynamic_state3, set with command::set_color_blending_enabled
+			color_write_mask		= 0x2000  // VK_EXT_extended_dynamic_state3, set with command::set_color_write_mask
+		};
+
+		inline dynamic_state operator| (dynamic_state a, dynamic_state b)
+		{
+			typedef std::underlying_type<dynamic_state>::type EnumType;
+			return static_cast<dynamic_state>(static_cast<EnumType>(a) | static_cast<EnumType>(b));
+		}
+
+		inline dynamic_state operator& (dynamic_state a, dynamic_state b)
+		{
+			typedef std::underlying_type<dynamic_state>::type EnumType;
+			return static_cast<dynamic_state>(static_cast<EnumType>(a) & static_cast<EnumType>(b));
+		}
+
+		inline dynamic_state& operator |= (dynamic_state& a, dynamic_state b)
+		{
+			return a = a | b;
+		}
+
+		inline dynamic_state& operator &= (dynamic_state& a, dynamic_state b)
+		{
+			return a = a & b;
+		}
+
 		/** An operation how to compare values - used for specifying how depth testing compares depth values */
 		enum struct compare_operation
 		{
@@ -587,6 +634,30 @@ namespace avk
 			return per_sample_shading_config { true, aMinFractionOfSamplesShaded };
 		}
 
+		/** Configure a graphics pipeline for dynamic rendering (VK_KHR_dynamic_rendering), i.e., to be used
+		 *	without a renderpass, within avk::command::begin_rendering. Instead of a renderpass and a subpass,
+		 *	only the formats and the sample count of the attachments which are rendered into are required.
+		 */
+		struct dynamic_rendering
+		{
+			/**	Configure dynamic rendering for the given attachment formats:
+			 *	@param	aColorFormats			The formats of the color attachments, in the order of their locations
+			 *	@param	aDepthStencilFormat		The format of the depth and/or stencil attachment, or vk::Format::eUndefined if there is none
+			 *	@param	aSampleCount			The number of samples of all the attachments
+			 */
+			static dynamic_rendering for_formats(std::vector<vk::Format> aColorFormats, vk::Format aDepthStencilFormat = vk::Format::eUndefined, vk::SampleCountFlagBits aSampleCount = vk::SampleCountFlagBits::e1);
+
+			/**	Configure dynamic rendering for the formats and the sample count of the given attachments,
+			 *	i.e., for the same attachments which are passed to avk::command::begin_rendering.
+			 */
+			static dynamic_rendering for_attachments(const std::vector<rendering_attachment>& aColorAttachments, const std::optional<rendering_attachment>& aDepthStencilAttachment = {});
+
+			std::vector<vk::Format> mColorAttachmentFormats;
+			vk::Format mDepthAttachmentFormat;
+			vk::Format mStencilAttachmentFormat;
+			vk::SampleCountFlagBits mSampleCount;
+		};
+
 		struct subpass_index
 		{
 			subpass_index(uint32_t subpassIndex) : mSubpassIndex{ subpassIndex } {}
@@ -608,7 +679,9 @@ namespace avk
 		~graphics_pipeline_config() = default;
 
 		cfg::pipeline_settings mPipelineSettings; // TODO: Handle settings!
+		cfg::dynamic_state mDynamicState;
 		std::optional<std::tuple<renderpass, uint32_t>> mRenderPassSubpass;
+		std::optional<cfg::dynamic_rendering> mDynamicRendering;
 		std::vector<input_binding_to_location_mapping> mInputBindingLocations;
 		cfg::primitive_topology mPrimitiveTopology;
 		std::vector<shader_info> mShaderInfos;
@@ -625,6 +698,8 @@ namespace avk
 		cfg::color_blending_settings mColorBlendingSettings;
 		std::vector<binding_data> mResourceBindings;
 		std::vector<push_constant_binding_data> mPushConstantsBindings;
+		std::optional<uint32_t> mPushDescriptorSetId;
+		std::vector<descriptor_set_layout_flags> mDescriptorSetLayoutFlags;
 		std::optional<cfg::tessellation_patch_control_points> mTessellationPatchControlPoints;
 		std::optional<cfg::per_sample_shading_config> mPerSampleShading;
 		std::optional<cfg::stencil_test> mStencilTest;
@@ -641,6 +716,14 @@ namespace avk
 		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
 	}
 
+	// Mark state as dynamic, i.e., not baked into the pipeline
+	template <typename... Ts>
+	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, cfg::dynamic_state aDynamicState, Ts... args)
+	{
+		aConfig.mDynamicState |= aDynamicState;
+		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
+	}
+
 	// Add a complete render pass to the pipeline config
 	template <typename... Ts>
 	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, renderpass aRenderPass, cfg::subpass_index aSubpassIndex, Ts... args)
@@ -672,6 +755,14 @@ namespace avk
 		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
 	}
 
+	// Configure the pipeline for dynamic rendering, i.e., without a renderpass
+	template <typename... Ts>
+	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, cfg::dynamic_rendering aDynamicRendering, Ts... args)
+	{
+		aConfig.mDynamicRendering = std::move(aDynamicRendering);
+		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
+	}
+
 	// Add a renderpass attachment to the (temporary) attachments vector and build renderpass afterwards
 	template <typename... Ts>
 	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, avk::attachment aAttachment, Ts... args)
@@ -848,6 +939,22 @@ namespace avk
 		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
 	}
 
+	// Declare one of the descriptor sets as push descriptor set
+	template <typename... Ts>
+	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, push_descriptor_set aPushDescriptorSet, Ts... args)
+	{
+		aConfig.mPushDescriptorSetId = aPushDescriptorSet.mSetId;
+		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
+	}
+
+	// Add create flags and binding flags for one of the descriptor set layouts
+	template <typename... Ts>
+	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, descriptor_set_layout_flags aLayoutFlags, Ts... args)
+	{
+		aConfig.mDescriptorSetLayoutFlags.push_back(std::move(aLayoutFlags));
+		add_config(aConfig, aAttachments, aFunc, std::move(args)...);
+	}
+
 	// Add an config-alteration function to the pipeline config
 	template <typename... Ts>
 	void add_config(graphics_pipeline_config& aConfig, std::vector<avk::attachment>& aAttachments, std::function<void(graphics_pipeline_t&)>& aFunc, std::function<void(graphics_pipeline_t&)> aAlterConfigBeforeCreation, Ts... args)
@@ -0,0 +1,140 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Records lists of commands in parallel into secondary command buffers.
+	 *
+	 *	A parallel_recorder owns a number of worker threads, and a command_pool_manager which provides each
+	 *	worker thread with its own command pools per frame in flight, so that no synchronization of command
+	 *	pools is required during recording.
+	 *	It is used through the action-type commands returned by render_pass(), rendering(), and execute():
+	 *	When such a command is recorded into a primary command buffer, the worker threads record all the
+	 *	chunks into secondary command buffers, which are subsequently executed via vkCmdExecuteCommands.
+	 *
+	 *	Chunks are recorded independently of each other. I.e., automatic synchronization (through
+	 *	avk::stage::auto_stage and avk::access::auto_access) does not look across the borders of chunks.
+	 *	Chunks must not contain commands which have been created through the same parallel_recorder,
+	 *	because its workers are busy with the outer chunks already. Such nested use throws.
+	 *
+	 *	The secondary command buffers are owned by the parallel_recorder and recycled across frames:
+	 *	Call begin_frame() once per frame, before recording, with the index of the frame in flight, but only
+	 *	after the GPU has finished executing the command buffers which have been recorded for that index before.
+	 *	A parallel_recorder must not be moved while commands which have been created through it are still in use.
+	 */
+	class parallel_recorder_t
+	{
+		friend class root;
+
+	public:
+		parallel_recorder_t() = default;
+		parallel_recorder_t(parallel_recorder_t&&) noexcept = default;
+		parallel_recorder_t(const parallel_recorder_t&) = delete;
+		parallel_recorder_t& operator=(parallel_recorder_t&&) noexcept;
+		parallel_recorder_t& operator=(const parallel_recorder_t&) = delete;
+		~parallel_recorder_t();
+
+		/** The number of worker threads of this parallel_recorder */
+		auto num_workers() const { return mNumWorkers; }
+		/** The queue family index which the command pools have been created for */
+		auto queue_family_index() const { return mQueueFamilyIndex; }
+
+		/**	Recycle the secondary command buffers which have been recorded for the given frame in flight,
+		 *	and record into them from now on. Must not be called concurrently to recording.
+		 *	@param	aFrameInFlightIndex		Index of the frame in flight; is taken modulo the number of frames in flight.
+		 */
+		void begin_frame(uint32_t aFrameInFlightIndex);
+
+		/**	Split a list of commands into (at most) the given number of chunks of similar size.
+		 *	@param	aCommands		The commands to be split into chunks. Their order is retained.
+		 *	@param	aNumChunks		The number of chunks; typically num_workers().
+		 */
+		static std::vector<std::vector<recorded_commands_t>> split(std::vector<recorded_commands_t> aCommands, uint32_t aNumChunks);
+
+		/**	Begins a renderpass, records the given chunks in parallel into secondary command buffers, executes them, and ends the renderpass.
+		 *	Only the first subpass of the renderpass is supported.
+		 *	@param	aRenderpass			Renderpass to begin
+		 *	@param	aFramebuffer		Framebuffer to use with the renderpass
+		 *	@param	aChunks				Chunks of commands, each one is recorded into a separate secondary command buffer
+		 *	@param	aRenderAreaOffset	Render area offset (default is (0,0), i.e., no offset)
+		 *	@param	aRenderAreaExtent	Render area extent (default is full extent)
+		 */
+		avk::command::action_type_command render_pass(
+			const renderpass_t& aRenderpass,
+			const framebuffer_t& aFramebuffer,
+			std::vector<std::vector<recorded_commands_t>> aChunks,
+			vk::Offset2D aRenderAreaOffset = { 0, 0 },
+			std::optional<vk::Extent2D> aRenderAreaExtent = {});
+
+		/**	Begins dynamic rendering, records the given chunks in parallel into secondary command buffers, executes them, and ends rendering.
+		 *	The secondary command buffers inherit the attachments' formats and sample count (see command::begin_rendering for the other parameters).
+		 *	@param	aColorAttachments		Color attachments, which are assigned to locations in the order in which they are given
+		 *	@param	aDepthStencilAttachment	Depth and/or stencil attachment (optional)
+		 *	@param	aChunks					Chunks of commands, each one is recorded into a separate secondary command buffer
+		 *	@param	aRenderAreaOffset		Render area offset (default is (0,0), i.e., no offset)
+		 *	@param	aRenderAreaExtent		Render area extent (default is the full extent of the first attachment's view)
+		 *	@param	aLayerCount				Number of layers which are rendered into (default is 1)
+		 */
+		avk::command::action_type_command rendering(
+			std::vector<rendering_attachment> aColorAttachments,
+			std::optional<rendering_attachment> aDepthStencilAttachment,
+			std::vector<std::vector<recorded_commands_t>> aChunks,
+			vk::Offset2D aRenderAreaOffset = { 0, 0 },
+			std::optional<vk::Extent2D> aRenderAreaExtent = {},
+			uint32_t aLayerCount = 1);
+
+		/**	Records the given chunks in parallel into secondary command buffers and executes them.
+		 *	Use this outside of renderpasses, e.g., for compute phases.
+		 *	@param	aChunks				Chunks of commands, each one is recorded into a separate secondary command buffer
+		 */
+		avk::command::action_type_command execute(std::vector<std::vector<recorded_commands_t>> aChunks);
+
+		/**	Records the given chunks in parallel into secondary command buffers, one per chunk.
+		 *	Blocks until all the chunks have been recorded.
+		 *	@param	aChunks				Chunks of commands, each one is recorded into a separate secondary command buffer
+		 *	@param	aInheritanceInfo	Inheritance info for the secondary command buffers. If it refers to a renderpass, or chains a
+		 *								vk::CommandBufferInheritanceRenderingInfoKHR, they are recorded to continue rendering.
+		 *	@return	The recorded secondary command buffers, in the order of aChunks. They are owned by this parallel_recorder
+		 *			and stay valid until begin_frame() is called for the same frame in flight again.
+		 */
+		std::vector<std::reference_wrapper<command_buffer_t>> record_in_parallel(const std::vector<std::vector<recorded_commands_t>>& aChunks, vk::CommandBufferInheritanceInfo aInheritanceInfo = {});
+
+	private:
+		struct worker_threads
+		{
+			std::vector<std::thread> mThreads;
+			std::mutex mMutex;
+			std::mutex mDispatchMutex;
+			std::condition_variable mWorkAvailable;
+			std::condition_variable mWorkDone;
+			std::function<void(uint32_t)> mJob;
+			uint64_t mGeneration = 0;
+			uint32_t mNumBusy = 0;
+			bool mStop = false;
+			std::exception_ptr mException;
+		};
+
+		// The formats which secondary command buffers inherit when they are executed within dynamic rendering:
+		struct rendering_inheritance
+		{
+			std::vector<vk::Format> mColorAttachmentFormats;
+			vk::Format mDepthAttachmentFormat = vk::Format::eUndefined;
+			vk::Format mStencilAttachmentFormat = vk::Format::eUndefined;
+			vk::SampleCountFlagBits mRasterizationSamples = vk::SampleCountFlagBits::e1;
+		};
+
+		static void worker_loop(worker_threads* aWorkerThreads, uint32_t aWorkerIndex);
+		void stop_workers();
+		void run_on_all_workers(std::function<void(uint32_t)> aJob);
+		avk::command::action_type_command execute_in_secondary_command_buffers(std::vector<std::vector<recorded_commands_t>> aChunks, vk::CommandBufferInheritanceInfo aInheritanceInfo, std::optional<rendering_inheritance> aRenderingInheritance = {});
+
+		const root* mRoot = nullptr;
+		uint32_t mQueueFamilyIndex = 0;
+		uint32_t mNumWorkers = 0;
+		uint32_t mFrameInFlightIndex = 0;
+		command_pool_manager mCommandPoolManager;
+		std::unique_ptr<worker_threads> mWorkerThreads;
+	};
+
+	using parallel_recorder = owning_resource<parallel_recorder_t>;
+}
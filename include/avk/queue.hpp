@@ -136,8 +136,19 @@ namespace avk
 		const auto& handle() const { return mQueue; }
 		const auto* handle_ptr() const { return &mQueue; }
 
+		/**	Submit one command buffer to this queue. The returned submission_data can be used to
+		 *	configure semaphore waits and signals, and it is submitted upon its destruction.
+		 *	If multiple command buffers are to be submitted to this queue at the same time (like,
+		 *	typically, in each frame), prefer submit_batch, which submits them with one single call.
+		 */
 		avk::submission_data submit(avk::command_buffer_t& aCommandBuffer) const;
 
+		/**	Create a batch of submissions to this queue, which are submitted with one single call
+		 *	to vkQueueSubmit2 upon submission_batch::submit or upon the batch's destruction.
+		 *	This is the recommended way to submit multiple command buffers.
+		 */
+		avk::submission_batch submit_batch() const;
+
 		bool is_prepared() const;
 		
 	private:
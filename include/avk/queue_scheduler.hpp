@@ -0,0 +1,114 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/** The kind of queue a job of a queue_scheduler is intended for */
+	enum struct queue_role
+	{
+		graphics,
+		async_compute,
+		transfer
+	};
+
+	/**	Distributes the jobs of a frame across a graphics, an async compute, and a transfer queue,
+	 *	and establishes the synchronization between jobs on different queues automatically.
+	 *
+	 *	Every job is recorded into a separate primary command buffer. A job can depend on previously added jobs.
+	 *	For each such dependency, the resources which are handed over from the earlier job to the dependent job
+	 *	are specified as image or buffer memory barriers, from the perspective of a barrier between the two jobs:
+	 *	 - If both jobs end up on the same queue, the barriers are recorded at the beginning of the dependent job.
+	 *	 - If both jobs end up on different queues, the dependent job waits on a timeline semaphore value which is
+	 *	   signaled by the earlier job's submission.
+	 *	 - If both queues belong to different queue families, every barrier is turned into a queue family ownership
+	 *	   transfer: The release barrier is recorded at the end of the earlier job, the acquire barrier at the
+	 *	   beginning of the dependent job. For images, both use the same layout transition.
+	 *
+	 *	All the jobs which have been assigned to the same queue are submitted in the order in which they have been
+	 *	added, with one single vkQueueSubmit2 call per queue. If no dedicated queue has been specified for a role,
+	 *	the jobs of that role are submitted to the graphics queue.
+	 *	Requires timeline semaphores (see root::create_timeline_semaphore).
+	 */
+	class queue_scheduler_t
+	{
+		friend class root;
+
+	public:
+		/** Index of a job, which is valid until the next submit() */
+		using job_index = size_t;
+
+		/** A dependency of a job on a previously added job */
+		struct dependency
+		{
+			/** The job which must have completed before the dependent job can start */
+			job_index mJob;
+			/** Image and buffer memory barriers for all the resources which are handed over between the two jobs */
+			std::vector<avk::sync::sync_type_command> mHandovers = {};
+			/** The stages of the dependent job which must wait, if the two jobs end up on different queues */
+			avk::stage::pipeline_stage_flags mWaitStage = avk::stage::all_commands;
+		};
+
+		queue_scheduler_t() = default;
+		queue_scheduler_t(queue_scheduler_t&&) noexcept = default;
+		queue_scheduler_t(const queue_scheduler_t&) = delete;
+		queue_scheduler_t& operator=(queue_scheduler_t&&) noexcept = default;
+		queue_scheduler_t& operator=(const queue_scheduler_t&) = delete;
+		~queue_scheduler_t() = default;
+
+		/** The queue which the jobs of the given role are submitted to */
+		const queue& queue_for(queue_role aRole) const;
+
+		/**	Add a job for the current frame.
+		 *	@param	aRole			Which kind of queue the job shall be submitted to
+		 *	@param	aCommands		The commands of the job
+		 *	@param	aDependencies	Dependencies on previously added jobs
+		 *	@return	The index of the added job, which can be referred to by dependencies of subsequently added jobs
+		 */
+		job_index add(queue_role aRole, std::vector<recorded_commands_t> aCommands, std::vector<dependency> aDependencies = {});
+
+		/** Make the given job's submission wait on an additional semaphore, e.g., for a swapchain image to become available. */
+		queue_scheduler_t& waiting_for(job_index aJob, avk::semaphore_wait_info aWaitInfo);
+		/** Make the given job's submission signal an additional semaphore, e.g., for presentation. */
+		queue_scheduler_t& signaling_upon_completion(job_index aJob, avk::semaphore_signal_info aSignalInfo);
+		/** Make the given job's submission signal a fence. At most one fence can be signaled per queue and frame. */
+		queue_scheduler_t& signaling_upon_completion(job_index aJob, avk::resource_argument<avk::fence_t> aFence);
+
+		/**	Record all the jobs which have been added since the last invocation, and submit them to their queues.
+		 *	The command buffers are taken from an internal command_pool_manager, whose frame in flight is reset first.
+		 *	I.e., the GPU must have finished executing all the jobs which have been submitted for the same frame in flight before.
+		 *	@param	aFrameInFlightIndex		Index of the frame in flight
+		 */
+		void submit(uint32_t aFrameInFlightIndex);
+
+		/**	The timeline semaphore which is signaled by all the submissions to the queue of the given role,
+		 *	together with the value that the most recent submission signals.
+		 */
+		std::tuple<const avk::semaphore_t&, uint64_t> timeline_for(queue_role aRole) const;
+
+	private:
+		struct job
+		{
+			size_t mQueueDataIndex;
+			std::vector<recorded_commands_t> mCommands;
+			std::vector<dependency> mDependencies;
+			std::vector<avk::semaphore_wait_info> mSemaphoreWaits;
+			std::vector<avk::semaphore_signal_info> mSemaphoreSignals;
+			std::optional<avk::resource_argument<avk::fence_t>> mFence;
+		};
+
+		struct queue_data
+		{
+			const queue* mQueue;
+			avk::semaphore mTimelineSemaphore;
+			uint64_t mTimelineValue = 0;
+		};
+
+		root* mRoot = nullptr;
+		std::array<size_t, 3> mQueueDataIndexForRole;
+		std::vector<queue_data> mQueueData;
+		avk::command_pool_manager mCommandPoolManager;
+		std::vector<job> mJobs;
+	};
+
+	using queue_scheduler = owning_resource<queue_scheduler_t>;
+}
@@ -87,6 +87,8 @@ namespace avk
 		max_recursion_depth mMaxRecursionDepth;
 		std::vector<binding_data> mResourceBindings;
 		std::vector<push_constant_binding_data> mPushConstantsBindings;
+		std::optional<uint32_t> mPushDescriptorSetId;
+		std::vector<descriptor_set_layout_flags> mDescriptorSetLayoutFlags;
 	};
 
 #pragma region shader_table_config convenience functions
@@ -198,6 +200,22 @@ namespace avk
 		add_config(aConfig, aFunc, std::move(args)...);
 	}
 
+	// Declare one of the descriptor sets as push descriptor set
+	template <typename... Ts>
+	void add_config(ray_tracing_pipeline_config& aConfig, std::function<void(ray_tracing_pipeline_t&)>& aFunc, push_descriptor_set aPushDescriptorSet, Ts... args)
+	{
+		aConfig.mPushDescriptorSetId = aPushDescriptorSet.mSetId;
+		add_config(aConfig, aFunc, std::move(args)...);
+	}
+
+	// Add create flags and binding flags for one of the descriptor set layouts
+	template <typename... Ts>
+	void add_config(ray_tracing_pipeline_config& aConfig, std::function<void(ray_tracing_pipeline_t&)>& aFunc, descriptor_set_layout_flags aLayoutFlags, Ts... args)
+	{
+		aConfig.mDescriptorSetLayoutFlags.push_back(std::move(aLayoutFlags));
+		add_config(aConfig, aFunc, std::move(args)...);
+	}
+
 	// Add an config-alteration function to the pipeline config
 	template <typename... Ts>
 	void add_config(ray_tracing_pipeline_config& aConfig, std::function<void(ray_tracing_pipeline_t&)>& aFunc, std::function<void(ray_tracing_pipeline_t&)> aAlterConfigBeforeCreation, Ts... args)
@@ -0,0 +1,85 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/** Describes an attachment for dynamic rendering (see avk::command::begin_rendering), i.e.,
+	 *	for rendering directly into an image view, without a renderpass and a framebuffer.
+	 *	It can describe color attachments as well as depth/stencil attachments.
+	 *
+	 *	In contrast to avk::attachment, no layout transitions are performed by the rendering commands.
+	 *	The image view must already be in the attachment's layout when rendering begins, i.e., the
+	 *	previous layout of the load operation and the target layout of the store operation are ignored.
+	 */
+	struct rendering_attachment
+	{
+		/**	Declare an attachment for dynamic rendering:
+		 *	@param	aImageView			The image view to render into (auto lifetime handling not supported)
+		 *	@param	aLoadOp				What shall happen to the contents of the attachment when rendering begins?
+		 *                              Possible values in namespace avk::on_load::
+		 *	@param	aStoreOp			What shall happen to the contents of the attachment when rendering ends?
+		 *                              Possible values in namespace avk::on_store::
+		 *	@param	aLayout				The layout the image view is in during rendering. If not set, it is
+		 *								depth_stencil_attachment_optimal for depth/stencil formats, and
+		 *								color_attachment_optimal otherwise.
+		 */
+		static rendering_attachment declare_for(const image_view_t& aImageView, attachment_load_config aLoadOp, attachment_store_config aStoreOp, std::optional<avk::layout::image_layout> aLayout = {});
+
+		/**	Resolve the multisampled contents of this attachment into another image view when rendering ends.
+		 *	@param	aResolveImageView	The (single-sampled) image view to resolve into (auto lifetime handling not supported)
+		 *	@param	aResolveMode		How to resolve the samples. If not set, it is sample_zero for depth/stencil formats, and average otherwise.
+		 *	@param	aResolveLayout		The layout the resolve image view is in. If not set, it is the same as this attachment's layout.
+		 */
+		rendering_attachment& resolve_to(const image_view_t& aResolveImageView, std::optional<vk::ResolveModeFlagBits> aResolveMode = {}, std::optional<avk::layout::image_layout> aResolveLayout = {});
+
+		rendering_attachment& set_clear_color(std::array<float, 4> aColor)			{ mColorClearValue = aColor; return *this; }
+		rendering_attachment& set_depth_clear_value(float aDepthClear)				{ mDepthClearValue = aDepthClear; return *this; }
+		rendering_attachment& set_stencil_clear_value(uint32_t aStencilClear)		{ mStencilClearValue = aStencilClear; return *this; }
+
+		rendering_attachment& set_load_operation(attachment_load_config aLoadOp)            { mLoadOperation = aLoadOp; return *this; }
+		rendering_attachment& set_store_operation(attachment_store_config aStoreOp)         { mStoreOperation = aStoreOp; return *this; }
+		rendering_attachment& set_stencil_load_operation(attachment_load_config aLoadOp)    { mStencilLoadOperation = aLoadOp; return *this; }
+		rendering_attachment& set_stencil_store_operation(attachment_store_config aStoreOp) { mStencilStoreOperation = aStoreOp; return *this; }
+
+		/** The color/depth/stencil format of the attachment */
+		auto format() const { return mFormat; }
+		/** The sample count for this attachment. */
+		auto sample_count() const { return mSampleCount; }
+		/** True if the format has a depth component */
+		bool has_depth_component() const { return is_depth_format(mFormat); }
+		/** True if the format has a stencil component */
+		bool has_stencil_component() const { return avk::has_stencil_component(mFormat); }
+		/** True if this attachment is to be bound as depth and/or stencil attachment */
+		bool is_depth_stencil_attachment() const { return has_depth_component() || has_stencil_component(); }
+		/** True if a multisample resolve shall be performed when rendering ends. */
+		bool is_to_be_resolved() const { return nullptr != mResolveImageView; }
+
+		/** Returns the stencil load operation */
+		auto get_stencil_load_op() const { return mStencilLoadOperation.value_or(mLoadOperation); }
+		/** Returns the stencil store operation */
+		auto get_stencil_store_op() const { return mStencilStoreOperation.value_or(mStoreOperation); }
+
+		/** Returns the clear value, either color or depth/stencil, depending on the format */
+		vk::ClearValue clear_value() const;
+
+		/** Assemble the attachment info for vk::RenderingInfoKHR.
+		 *	@param	aForStencil		If true, the info is assembled for the stencil aspect, i.e., with the stencil load and store operations.
+		 */
+		vk::RenderingAttachmentInfoKHR to_vk_rendering_attachment_info(bool aForStencil = false) const;
+
+		const image_view_t* mImageView;
+		vk::Format mFormat;
+		vk::SampleCountFlagBits mSampleCount;
+		vk::ImageLayout mLayout;
+		attachment_load_config mLoadOperation;
+		attachment_store_config mStoreOperation;
+		std::optional<attachment_load_config> mStencilLoadOperation;
+		std::optional<attachment_store_config> mStencilStoreOperation;
+		const image_view_t* mResolveImageView;
+		vk::ResolveModeFlagBits mResolveMode;
+		vk::ImageLayout mResolveLayout;
+		std::array<float, 4> mColorClearValue;
+		float mDepthClearValue;
+		uint32_t mStencilClearValue;
+	};
+}
@@ -6,7 +6,10 @@ namespace avk
 	// Forward declaration:
 	class queue;
 
-	/** A synchronization object which allows GPU->GPU synchronization */
+	/** A synchronization object which allows GPU->GPU synchronization.
+	 *	If it has been created as a timeline semaphore (see root::create_timeline_semaphore),
+	 *	it also allows GPU->host and host->GPU synchronization through its 64-bit counter value.
+	 */
 	class semaphore_t
 	{
 		friend class root;
@@ -48,9 +51,43 @@ namespace avk
 		const auto& handle() const { return mSemaphore.get(); }
 		const auto* handle_addr() const { return &mSemaphore.get(); }
 
+		/** Returns true if this semaphore has been created as a timeline semaphore */
+		bool is_timeline_semaphore() const { return vk::SemaphoreType::eTimeline == mTypeCreateInfo.semaphoreType; }
+
+		/**	Query the current counter value of this timeline semaphore.
+		 *	Must only be invoked for timeline semaphores.
+		 */
+		uint64_t current_value() const;
+
+		/**	Block on the host until the counter value of this timeline semaphore has reached at least the given value.
+		 *	Must only be invoked for timeline semaphores.
+		 *	@param	aValue		The counter value to wait for
+		 *	@param	aTimeout	Timeout in nanoseconds. Waits indefinitely if no value is set.
+		 *	@return	true if the value has been reached, false if the timeout expired before.
+		 */
+		bool wait(uint64_t aValue, std::optional<uint64_t> aTimeout = {}) const;
+
+		/**	Set the counter value of this timeline semaphore from the host.
+		 *	Must only be invoked for timeline semaphores.
+		 *	@param	aValue		The new counter value. Must be greater than the current value.
+		 */
+		void signal(uint64_t aValue) const;
+
+		/**	Export the payload of this binary semaphore as sync file descriptor through VK_KHR_external_semaphore_fd.
+		 *	The semaphore must have been created via root::create_semaphore_for_export, and it must have a pending
+		 *	signal operation, which exporting consumes. The returned file descriptor becomes readable (e.g., for poll
+		 *	or epoll) once the semaphore's signal operation has completed, and it must be closed by the caller.
+		 *	@param	aDispatchLoader		The extensions dispatch loader, e.g., root::dispatch_loader_ext()
+		 */
+		int export_sync_fd(const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader) const;
+
 	private:
 		// The semaphore config struct:
 		vk::SemaphoreCreateInfo mCreateInfo;
+		// The semaphore type, which is chained to mCreateInfo for timeline semaphores:
+		vk::SemaphoreTypeCreateInfo mTypeCreateInfo;
+		// The handle types this semaphore can be exported as, which are chained to mCreateInfo if set:
+		vk::ExportSemaphoreCreateInfo mExportCreateInfo;
 		// The semaphore handle:
 		vk::UniqueHandle<vk::Semaphore, DISPATCH_LOADER_CORE_TYPE> mSemaphore;
 
@@ -25,7 +25,12 @@ namespace avk
 		const auto& required_pool_sizes() const { return mBindingRequirements; }
 		std::vector<vk::DescriptorSetLayout> layout_handles() const;
 
-		static set_of_descriptor_set_layouts prepare(std::vector<binding_data> pBindings);
+		/**	Prepare the layouts of all the sets from 0 up to the highest set-id of the given bindings.
+		 *	@param	pBindings				The bindings of all the sets
+		 *	@param	pPushDescriptorSetId	If set, the layout with this set-id is prepared for push descriptors
+		 *	@param	pLayoutFlags			Create flags and binding flags for the layouts of specific set-ids
+		 */
+		static set_of_descriptor_set_layouts prepare(std::vector<binding_data> pBindings, std::optional<uint32_t> pPushDescriptorSetId = {}, const std::vector<descriptor_set_layout_flags>& pLayoutFlags = {});
 		
 	private:
 		std::vector<vk::DescriptorPoolSize> mBindingRequirements;
@@ -0,0 +1,136 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Uploads buffer and image data on a (typically dedicated) transfer queue, so that
+	 *	streaming of resources does not compete with the rendering work on other queues.
+	 *
+	 *	Upload requests can be issued from any thread. They only copy the data into host memory.
+	 *	All the requests which have been issued until the next tick() are batched into one command buffer,
+	 *	copied into one staging buffer, and submitted with one submission, which signals the next value of
+	 *	this uploader's timeline semaphore. Staging buffers and command buffers are recycled once their
+	 *	submissions have completed. tick() can be invoked manually, or periodically by a background thread.
+	 *
+	 *	If the consuming queue belongs to a different queue family than the transfer queue, the ownership of
+	 *	the uploaded resources is released to the consuming queue family at the end of the upload. In this case,
+	 *	the consumer must record the acquire barrier of the upload_ticket before it accesses the resource.
+	 *	In any case, the consumer must wait on the upload_ticket's value of timeline_semaphore(), e.g.:
+	 *	  submission.waiting_for(avk::with_value(uploader->timeline_semaphore(), ticket.mTimelineValue) >> avk::stage::vertex_input);
+	 *
+	 *	The destination buffers and images must stay alive until their uploads have completed.
+	 *	Upon destruction, all the pending requests are submitted, and their completion is awaited.
+	 */
+	class streaming_uploader_t
+	{
+		friend class root;
+
+	public:
+		/** Describes when an upload is ready for use by the consuming queue */
+		struct upload_ticket
+		{
+			/** The value of timeline_semaphore() which is signaled when the upload has completed */
+			uint64_t mTimelineValue;
+			/** The acquire barrier to be recorded on the consuming queue; only set if a queue family ownership transfer is required */
+			std::optional<avk::sync::sync_type_command> mAcquireBarrier;
+		};
+
+		streaming_uploader_t() = default;
+		streaming_uploader_t(streaming_uploader_t&&) noexcept = default;
+		streaming_uploader_t(const streaming_uploader_t&) = delete;
+		streaming_uploader_t& operator=(streaming_uploader_t&&) noexcept;
+		streaming_uploader_t& operator=(const streaming_uploader_t&) = delete;
+		~streaming_uploader_t();
+
+		/**	Request an upload into a device buffer.
+		 *	@param	aDstBuffer			The buffer to upload the data into
+		 *	@param	aData				Pointer to the data. It is copied immediately, i.e., it can be freed after this call.
+		 *	@param	aSize				Size of the data in bytes
+		 *	@param	aDstOffset			Offset into aDstBuffer in bytes
+		 *	@param	aConsumer			Stage and access on the consuming queue which use the buffer afterwards
+		 */
+		upload_ticket upload(const buffer_t& aDstBuffer, const void* aData, size_t aSize, vk::DeviceSize aDstOffset, avk::stage_and_access aConsumer);
+
+		/**	Request an upload into an image.
+		 *	@param	aDstImage			The image to upload the data into
+		 *	@param	aData				Pointer to the data. It is copied immediately, i.e., it can be freed after this call.
+		 *	@param	aSize				Size of the data in bytes
+		 *	@param	aRegions			The mip levels, array layers, and image regions to copy the data into.
+		 *								Their buffer offsets refer to aData.
+		 *	@param	aLayoutTransition	The image's current layout, and the layout it shall have after the upload
+		 *	@param	aConsumer			Stage and access on the consuming queue which use the image afterwards
+		 */
+		upload_ticket upload(const image_t& aDstImage, const void* aData, size_t aSize, std::vector<vk::BufferImageCopy> aRegions, avk::layout::image_layout_transition aLayoutTransition, avk::stage_and_access aConsumer);
+
+		/**	Record and submit all the pending upload requests.
+		 *	Requests which are issued concurrently to a tick() are submitted with the next tick.
+		 *	If the submission fails, the exception is rethrown, and the requests stay pending, so that they are
+		 *	retried with the next tick. Their tickets are then satisfied by the (greater) value of that tick.
+		 *	@return	The timeline value which is signaled after all the uploads requested before have completed.
+		 */
+		uint64_t tick();
+
+		/** The timeline semaphore which signals the completion of uploads */
+		const avk::semaphore_t& timeline_semaphore() const { return mState->mTimelineSemaphore.get(); }
+
+		/** The number of staging bytes which are currently allocated, either in use or available for reuse */
+		vk::DeviceSize num_staging_bytes() const;
+
+	private:
+		struct request
+		{
+			std::vector<uint8_t> mData;
+			std::variant<const buffer_t*, const image_t*> mDst;
+			vk::DeviceSize mDstOffset;
+			std::vector<vk::BufferImageCopy> mRegions;
+			avk::layout::image_layout_transition mLayoutTransition;
+		};
+
+		struct in_flight
+		{
+			uint64_t mTimelineValue;
+			command_buffer mCommandBuffer;
+			buffer mStagingBuffer;
+		};
+
+		// Everything is stored in here, so that it stays at the same place for the tick thread:
+		struct state
+		{
+			root* mRoot = nullptr;
+			const queue* mQueue = nullptr;
+			uint32_t mConsumerQueueFamilyIndex = 0;
+			vk::DeviceSize mMinStagingBufferSize = 0;
+
+			// Serializes the submissions (so that timeline values are signaled in increasing order), and guards mCommandPool:
+			std::mutex mSubmitMutex;
+			command_pool mCommandPool;
+			avk::semaphore mTimelineSemaphore;
+
+			// Guards the following members, but is never held while recording or submitting:
+			std::mutex mMutex;
+			// The timeline value which the next batch of requests signals, i.e., the one handed out to pending requests:
+			uint64_t mNextValue = 1;
+			// The timeline value of the last batch of requests which has been submitted successfully:
+			uint64_t mLastSubmittedValue = 0;
+			std::vector<request> mPendingRequests;
+			std::vector<in_flight> mInFlight;
+			std::vector<buffer> mAvailableStagingBuffers;
+
+			std::thread mTickThread;
+			std::condition_variable mStopTicking;
+			bool mStop = false;
+		};
+
+		static uint64_t submit_pending_requests(state& aState);
+		static buffer get_staging_buffer(state& aState, vk::DeviceSize aMinSize);
+		static vk::DeviceSize staging_alignment(const request& aRequest);
+		static command_buffer record_and_submit(state& aState, const std::vector<request>& aRequests, const std::vector<vk::DeviceSize>& aStagingOffsets, const buffer_t& aStaging, uint64_t aTimelineValue);
+		upload_ticket enqueue(request aRequest, std::optional<avk::sync::sync_type_command> aAcquireBarrier);
+		void stop_tick_thread();
+		void finish_pending_work();
+
+		std::unique_ptr<state> mState;
+	};
+
+	using streaming_uploader = owning_resource<streaming_uploader_t>;
+}
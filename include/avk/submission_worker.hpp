@@ -0,0 +1,86 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	Submits work to one queue on a dedicated thread, so that threads which record command buffers
+	 *	never have to block inside the driver's vkQueueSubmit2 implementation.
+	 *
+	 *	Submissions are handed over through a lock-free multi-producer single-consumer queue, i.e., push()
+	 *	can be invoked from any number of threads concurrently. The worker thread takes all the submissions
+	 *	which have been pushed since its last iteration and submits them---in the order in which they
+	 *	have been pushed---as submission_batches, i.e., with one single call to vkQueueSubmit2 per batch.
+	 *	Since a batch can only signal one fence, a new batch is started for every further submission with a fence.
+	 *
+	 *	The submission_data only references its command buffer, semaphores, and fence (unless they have been
+	 *	passed as owning resources). All of them must stay alive until the submission has been handed over
+	 *	to the driver, which is reported through the returned future or the given callback. Neither of them
+	 *	reports the completion of the work on the device; to get notified about that, track the submission
+	 *	with a completion_tracker before it is pushed.
+	 *	The queue must outlive the submission_worker.
+	 */
+	class submission_worker_t
+	{
+		friend class root;
+
+	public:
+		submission_worker_t() = default;
+		submission_worker_t(submission_worker_t&&) noexcept = default;
+		submission_worker_t(const submission_worker_t&) = delete;
+		submission_worker_t& operator=(submission_worker_t&&) noexcept;
+		submission_worker_t& operator=(const submission_worker_t&) = delete;
+		~submission_worker_t();
+
+		/** The queue which this submission_worker submits to */
+		const auto& queue_to_submit_to() const { return *mQueue; }
+
+		/**	Hand over a submission to the worker thread.
+		 *	It must either have no queue assigned, or the same queue as this submission_worker.
+		 *	Throws an avk::logic_error (on the calling thread) otherwise.
+		 *	Use submission_data::store_for_now() to pass a submission, e.g.:
+		 *	  worker.push(queue.submit(cmdBfr).signaling_upon_completion(fence).store_for_now());
+		 *	@return	A future which becomes ready after the submission has been submitted to the queue.
+		 *			It rethrows any exception that occurred during submission.
+		 */
+		std::future<void> push(submission_data&& aSubmission);
+
+		/**	Hand over a submission to the worker thread.
+		 *	@param	aSubmission		The submission; same requirements as for the other push-overload.
+		 *	@param	aOnSubmitted	Invoked on the worker thread after the submission has been submitted to the queue.
+		 *							Its parameter is set if an exception occurred during submission.
+		 *							Exceptions thrown by it are logged and otherwise ignored.
+		 */
+		void push(submission_data&& aSubmission, std::function<void(std::exception_ptr)> aOnSubmitted);
+
+	private:
+		// A node of the intrusive, lock-free MPSC queue:
+		struct node
+		{
+			submission_data mSubmission;
+			std::promise<void> mPromise;
+			std::function<void(std::exception_ptr)> mOnSubmitted;
+			node* mNext = nullptr;
+		};
+
+		struct worker_thread
+		{
+			std::thread mThread;
+			// Head of a singly-linked list of pushed nodes, in reverse order of pushing:
+			std::atomic<node*> mHead = nullptr;
+			// Incremented on every push; the worker thread waits on it while there is nothing to do:
+			std::atomic<uint64_t> mNumPushes = 0;
+			std::atomic<bool> mStop = false;
+		};
+
+		static void worker_loop(const root* aRoot, const queue* aQueue, worker_thread* aWorkerThread);
+		void stop_worker();
+		void validate(const submission_data& aSubmission) const;
+		void enqueue(node* aNode);
+
+		const root* mRoot = nullptr;
+		const queue* mQueue = nullptr;
+		std::unique_ptr<worker_thread> mWorkerThread;
+	};
+
+	using submission_worker = owning_resource<submission_worker_t>;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <avk/avk.hpp>
+
+namespace avk
+{
+	/**	A persistently mapped, host-coherent buffer which hands out aligned sub-allocations for
+	 *	per-object uniform (or storage) data, so that many objects can share one descriptor set and one buffer.
+	 *
+	 *	The buffer is divided into one region per frame in flight. begin_frame() resets the region of the
+	 *	given frame in flight, which must not be in use by the GPU anymore. allocate() and push() can be
+	 *	invoked from multiple threads concurrently; they return the offset of the sub-allocation, which must
+	 *	be passed as dynamic offset to bind_descriptors. The descriptor set must contain the buffer as dynamic
+	 *	uniform buffer (or dynamic storage buffer), e.g.:
+	 *	  descriptorCache->get_or_create_descriptor_sets({ avk::descriptor_binding(0, 0, ring->as_dynamic_uniform_buffer(sizeof(object_data))) });
+	 *	  auto alloc = ring->push(objectData);
+	 *	  avk::command::bind_descriptors(pipeline->layout(), descriptorSets, { alloc.mOffset });
+	 */
+	class uniform_ring_t
+	{
+		friend class root;
+
+	public:
+		/** A sub-allocation within the current frame's region */
+		struct allocation
+		{
+			/** Pointer to the mapped memory of the sub-allocation */
+			void* mData;
+			/** Offset from the beginning of the buffer, to be passed as dynamic offset */
+			uint32_t mOffset;
+			/** Size of the sub-allocation in bytes */
+			vk::DeviceSize mSize;
+		};
+
+		uniform_ring_t() = default;
+		uniform_ring_t(uniform_ring_t&&) noexcept = default;
+		uniform_ring_t(const uniform_ring_t&) = delete;
+		uniform_ring_t& operator=(uniform_ring_t&&) noexcept = default;
+		uniform_ring_t& operator=(const uniform_ring_t&) = delete;
+		~uniform_ring_t() = default;
+
+		/**	Start allocating from the region of the given frame, and discard all its previous sub-allocations.
+		 *	Must not be invoked concurrently with allocate() or push().
+		 *	@param	aFrameId	Index of the current frame; the region that is used is aFrameId % number of frames in flight
+		 */
+		void begin_frame(int64_t aFrameId);
+
+		/**	Allocate a sub-range of the current frame's region, aligned to the device's minimum offset alignment.
+		 *	Throws an avk::runtime_error if the region is exhausted.
+		 *	@param	aSize		Size of the sub-allocation in bytes
+		 */
+		allocation allocate(vk::DeviceSize aSize);
+
+		/** Allocate a sub-range of the current frame's region and copy the given data into it. */
+		template <typename T>
+		allocation push(const T& aData)
+		{
+			auto result = allocate(sizeof(T));
+			std::memcpy(result.mData, &aData, sizeof(T));
+			return result;
+		}
+
+		/** The buffer which all the sub-allocations are made from */
+		const buffer_t& buffer() const { return mState->mBuffer.get(); }
+
+		/** Get a buffer_descriptor for binding the buffer as a dynamic uniform buffer, where shaders see aRange bytes from the dynamic offset on. */
+		buffer_descriptor as_dynamic_uniform_buffer(vk::DeviceSize aRange) const { return buffer().as_dynamic_uniform_buffer(aRange); }
+		/** Get a buffer_descriptor for binding the buffer as a dynamic storage buffer, where shaders see aRange bytes from the dynamic offset on. */
+		buffer_descriptor as_dynamic_storage_buffer(vk::DeviceSize aRange) const { return buffer().as_dynamic_storage_buffer(aRange); }
+
+		/** The size of each frame's region in bytes */
+		auto bytes_per_frame() const { return mBytesPerFrame; }
+		/** The alignment of all the sub-allocations in bytes */
+		auto alignment() const { return mAlignment; }
+		/** The number of bytes which have been allocated from the current frame's region so far, including alignment padding */
+		vk::DeviceSize bytes_allocated() const;
+
+	private:
+		// Everything is stored in here, so that the mapping stays valid when the ring is moved:
+		struct state
+		{
+			avk::buffer mBuffer;
+			std::optional<scoped_mapping<AVK_MEM_BUFFER_HANDLE>> mMapping;
+			std::atomic<vk::DeviceSize> mNextOffset = 0;
+		};
+
+		vk::DeviceSize mBytesPerFrame = 0;
+		vk::DeviceSize mAlignment = 1;
+		uint32_t mNumFramesInFlight = 1;
+		vk::DeviceSize mRegionBegin = 0;
+		std::unique_ptr<state> mState;
+	};
+
+	using uniform_ring = owning_resource<uniform_ring_t>;
+}
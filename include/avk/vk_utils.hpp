@@ -109,6 +109,11 @@ namespace avk
 	/** Returns true if the given image format is one of the block compressed formats.
 	*	Please note: This function does not guarantee completeness for all formats, i.e. false negatives must be expected. */
 	extern bool is_block_compressed_format(const vk::Format& aImageFormat);
+
+	/** Returns the size of one texel block of the given format in bytes, i.e., the size of one texel for
+	*	uncompressed formats, and the size of one compressed block for block compressed formats.
+	*	If the Vulkan headers do not provide the format traits, a conservative multiple of all texel block sizes is returned. */
+	extern uint32_t texel_block_size(const vk::Format& aImageFormat);
 	
 	/** Returns true if the given image format is a depth/depth-stencil format and has a stencil component.
 	*	Please note: This function does not guarantee completeness for all formats, i.e. false negatives must be expected. */
@@ -546,6 +546,16 @@ namespace avk
 		return it != bcFormats.end();
 	}
 
+	uint32_t texel_block_size(const vk::Format& aImageFormat)
+	{
+#if VK_HEADER_VERSION >= 213
+		return std::max(static_cast<uint32_t>(vk::blockSize(aImageFormat)), 1u);
+#else
+		// Least common multiple of all the texel block sizes of the core formats (1, 2, 3, 4, 6, 8, 12, 16, 24, 32):
+		return 96u;
+#endif
+	}
+
 	bool has_stencil_component(const vk::Format& aImageFormat)
 	{
 		static std::set<vk::Format> stencilFormats = {
@@ -1422,6 +1432,64 @@ namespace avk
 	}
 #pragma endregion
 
+#pragma region rendering attachment definitions
+	rendering_attachment rendering_attachment::declare_for(const image_view_t& aImageView, attachment_load_config aLoadOp, attachment_store_config aStoreOp, std::optional<avk::layout::image_layout> aLayout)
+	{
+		const auto format = aImageView.create_info().format;
+		const auto isDepthStencil = is_depth_format(format) || avk::has_stencil_component(format);
+		const auto layout = aLayout.has_value()
+			? aLayout->mLayout
+			: (isDepthStencil ? vk::ImageLayout::eDepthStencilAttachmentOptimal : vk::ImageLayout::eColorAttachmentOptimal);
+		return rendering_attachment{
+			&aImageView,
+			format,
+			aImageView.get_image().create_info().samples,
+			layout,
+			aLoadOp, aStoreOp,
+			{},      {},
+			nullptr, vk::ResolveModeFlagBits::eNone, layout,
+			{ 0.0, 0.0, 0.0, 0.0 },
+			1.0f, 0u
+		};
+	}
+
+	rendering_attachment& rendering_attachment::resolve_to(const image_view_t& aResolveImageView, std::optional<vk::ResolveModeFlagBits> aResolveMode, std::optional<avk::layout::image_layout> aResolveLayout)
+	{
+		if (vk::SampleCountFlagBits::e1 == mSampleCount) {
+			throw avk::logic_error("Only multisampled attachments can be resolved.");
+		}
+		mResolveImageView = &aResolveImageView;
+		mResolveMode = aResolveMode.value_or(is_depth_stencil_attachment() ? vk::ResolveModeFlagBits::eSampleZero : vk::ResolveModeFlagBits::eAverage);
+		mResolveLayout = aResolveLayout.has_value() ? aResolveLayout->mLayout : mLayout;
+		return *this;
+	}
+
+	vk::ClearValue rendering_attachment::clear_value() const
+	{
+		if (is_depth_stencil_attachment()) {
+			return vk::ClearDepthStencilValue{ mDepthClearValue, mStencilClearValue };
+		}
+		return vk::ClearColorValue{ mColorClearValue };
+	}
+
+	vk::RenderingAttachmentInfoKHR rendering_attachment::to_vk_rendering_attachment_info(bool aForStencil) const
+	{
+		auto result = vk::RenderingAttachmentInfoKHR{}
+			.setImageView(mImageView->handle())
+			.setImageLayout(mLayout)
+			.setLoadOp(to_vk_load_op(aForStencil ? get_stencil_load_op().mLoadBehavior : mLoadOperation.mLoadBehavior))
+			.setStoreOp(to_vk_store_op(aForStencil ? get_stencil_store_op().mStoreBehavior : mStoreOperation.mStoreBehavior))
+			.setClearValue(clear_value());
+		if (is_to_be_resolved()) {
+			result
+				.setResolveMode(mResolveMode)
+				.setResolveImageView(mResolveImageView->handle())
+				.setResolveImageLayout(mResolveLayout);
+		}
+		return result;
+	}
+#pragma endregion
+
 #pragma region acceleration structure definitions
 #if VK_HEADER_VERSION >= 135
 	acceleration_structure_size_requirements acceleration_structure_size_requirements::from_buffers(vertex_index_buffer_pair aPair)
@@ -2826,6 +2894,102 @@ namespace avk
 		return result;
 	}
 
+	void command_pool_t::reset(vk::CommandPoolResetFlags aFlags)
+	{
+		mCommandPool->getOwner().resetCommandPool(handle(), aFlags, mRoot->dispatch_loader_core());
+	}
+
+	command_pool_manager root::create_command_pool_manager(uint32_t aNumFramesInFlight)
+	{
+		command_pool_manager_t result;
+		result.mRoot = this;
+		result.mNumFramesInFlight = std::max(1u, aNumFramesInFlight);
+		return result;
+	}
+
+	command_buffer_t& command_pool_manager_t::get_command_buffer(uint32_t aFrameInFlightIndex, uint32_t aQueueFamilyIndex, vk::CommandBufferLevel aLevel)
+	{
+		const auto key = pool_key{ std::this_thread::get_id(), aFrameInFlightIndex % mNumFramesInFlight, aQueueFamilyIndex };
+
+		pool_and_buffers* entry = nullptr;
+		{
+			std::scoped_lock lock{ *mMutex };
+			auto it = mPools.find(key);
+			if (std::end(mPools) == it) {
+				auto newEntry = std::make_unique<pool_and_buffers>();
+				newEntry->mCommandPool = mRoot->create_command_pool(aQueueFamilyIndex, vk::CommandPoolCreateFlagBits::eTransient);
+				it = mPools.emplace(key, std::move(newEntry)).first;
+			}
+			entry = it->second.get();
+		}
+
+		// From here on, the entry is only accessed by the calling thread:
+		const bool isPrimary = vk::CommandBufferLevel::ePrimary == aLevel;
+		auto& buffers  = isPrimary ? entry->mPrimaryCommandBuffers : entry->mSecondaryCommandBuffers;
+		auto& numInUse = isPrimary ? entry->mNumPrimaryInUse : entry->mNumSecondaryInUse;
+		if (numInUse == buffers.size()) {
+			buffers.push_back(entry->mCommandPool->alloc_command_buffer(vk::CommandBufferUsageFlagBits::eOneTimeSubmit, aLevel));
+			std::scoped_lock lock{ *mMutex };
+			++mNumAllocatedCommandBuffers;
+		}
+		return buffers[numInUse++].get();
+	}
+
+	void command_pool_manager_t::reset_frame(uint32_t aFrameInFlightIndex)
+	{
+		const auto frameInFlightIndex = aFrameInFlightIndex % mNumFramesInFlight;
+
+		std::scoped_lock lock{ *mMutex };
+		for (auto it = std::begin(mPools); it != std::end(mPools); ) {
+			auto& [key, entry] = *it;
+			if (key.mFrameInFlightIndex != frameInFlightIndex) {
+				++it;
+				continue;
+			}
+			// The pool's thread has not recorded anything for a while (or does not exist anymore) => release it:
+			if (0 == entry->mNumPrimaryInUse && 0 == entry->mNumSecondaryInUse) {
+				if (++entry->mNumIdleResets >= num_idle_resets_before_release()) {
+					mNumAllocatedCommandBuffers -= entry->mPrimaryCommandBuffers.size() + entry->mSecondaryCommandBuffers.size();
+					it = mPools.erase(it);
+					continue;
+				}
+			}
+			else {
+				entry->mNumIdleResets = 0;
+			}
+			for (size_t i = 0; i < entry->mNumPrimaryInUse; ++i) {
+				entry->mPrimaryCommandBuffers[i]->prepare_for_reuse();
+			}
+			for (size_t i = 0; i < entry->mNumSecondaryInUse; ++i) {
+				entry->mSecondaryCommandBuffers[i]->prepare_for_reuse();
+			}
+			// Reset all command buffers of this pool at once:
+			entry->mCommandPool->reset();
+			entry->mNumPrimaryInUse = 0;
+			entry->mNumSecondaryInUse = 0;
+			++it;
+		}
+	}
+
+	void command_pool_manager_t::release_thread_pools(std::thread::id aThreadId)
+	{
+		std::scoped_lock lock{ *mMutex };
+		for (auto it = std::begin(mPools); it != std::end(mPools); ) {
+			if (it->first.mThreadId != aThreadId) {
+				++it;
+				continue;
+			}
+			mNumAllocatedCommandBuffers -= it->second->mPrimaryCommandBuffers.size() + it->second->mSecondaryCommandBuffers.size();
+			it = mPools.erase(it);
+		}
+	}
+
+	size_t command_pool_manager_t::num_allocated_command_buffers() const
+	{
+		std::scoped_lock lock{ *mMutex };
+		return mNumAllocatedCommandBuffers;
+	}
+
 	// prepare command buffer for re-recording
 	void command_buffer_t::prepare_for_reuse()
 	{
@@ -2841,6 +3005,11 @@ namespace avk
 		mLifetimeHandledResources.clear();
 	}
 
+	void command_buffer_t::release_lifetime_handled_resources()
+	{
+		mLifetimeHandledResources.clear();
+	}
+
 	void command_buffer_t::reset()
 	{
 		prepare_for_reuse();
@@ -2876,8 +3045,15 @@ namespace avk
 
 	void command_buffer_t::begin_recording()
 	{
+		if (mInheritanceInfo.has_value()) {
+			// Set it right here, because this command buffer might have been moved after the inheritance info has been set:
+			mBeginInfo.setPInheritanceInfo(&mInheritanceInfo.value());
+		}
 		mCommandBuffer->begin(mBeginInfo);
 		mState = command_buffer_state::recording;
+		// Nothing is bound at the beginning of recording:
+		mBoundState = {};
+		mElidedBinds = {};
 	}
 
 	void command_buffer_t::end_recording()
@@ -2886,44 +3062,305 @@ namespace avk
 		mState = command_buffer_state::finished_recording;
 	}
 
-	void command_buffer_t::bind_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, std::vector<descriptor_set> aDescriptorSets)
+	void command_buffer_t::bind_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, std::vector<descriptor_set> aDescriptorSets, std::vector<uint32_t> aDynamicOffsets)
 	{
 		if (aDescriptorSets.size() == 0) {
 			AVK_LOG_WARNING("command_buffer_t::bind_descriptors has been called, but there are no descriptor sets to be bound.");
 			return;
 		}
 
+#if VK_HEADER_VERSION >= 235
+		if (aDescriptorSets.front().is_in_descriptor_buffer()) {
+			if (!aDynamicOffsets.empty()) {
+				throw avk::logic_error("Dynamic offsets are not supported for descriptor sets which reside in a descriptor buffer.");
+			}
+			bind_descriptors_from_descriptor_buffer(aBindingPoint, aLayoutHandle, aDescriptorSets);
+			return;
+		}
+#endif
+
+		const auto bpi = bind_point_index(aBindingPoint);
+		auto& boundSets = mBoundState.mDescriptorSets[bpi];
+		if (mBoundState.mDescriptorSetsLayouts[bpi] != aLayoutHandle) {
+			// Binding with a different layout might disturb the sets which have been bound before => forget about them
+			boundSets.clear();
+			mBoundState.mDescriptorSetsLayouts[bpi] = aLayoutHandle;
+		}
+
+		size_t numDynamicOffsets = 0;
+		for (const auto& dset : aDescriptorSets) {
+			numDynamicOffsets += dset.number_of_dynamic_offsets();
+		}
+		if (aDynamicOffsets.size() != numDynamicOffsets) {
+			throw avk::logic_error("The descriptor sets passed to bind_descriptors contain " + std::to_string(numDynamicOffsets) + " dynamic descriptors, but " + std::to_string(aDynamicOffsets.size()) + " dynamic offsets have been passed.");
+		}
+
 		std::vector<vk::DescriptorSet> handles;
+		std::vector<uint32_t> setIds;
+		std::vector<std::vector<uint32_t>> dynamicOffsets; // per set
 		handles.reserve(aDescriptorSets.size());
+		setIds.reserve(aDescriptorSets.size());
+		dynamicOffsets.reserve(aDescriptorSets.size());
+		auto nextOffset = std::begin(aDynamicOffsets);
 		for (const auto& dset : aDescriptorSets)
 		{
+			std::vector<uint32_t> setOffsets(nextOffset, nextOffset + dset.number_of_dynamic_offsets());
+			nextOffset += setOffsets.size();
+
+			// Skip sets which are bound to the same set index with the same dynamic offsets already:
+			if (mRedundantBindFilteringEnabled && dset.set_id() < boundSets.size() && boundSets[dset.set_id()].mHandle == dset.handle() && boundSets[dset.set_id()].mDynamicOffsets == setOffsets) {
+				++mElidedBinds.mDescriptorSets;
+				continue;
+			}
 			handles.push_back(dset.handle());
+			setIds.push_back(dset.set_id());
+			dynamicOffsets.push_back(std::move(setOffsets));
 		}
 
-		if (aDescriptorSets.empty()) {
+		if (handles.empty()) {
 			return;
 		}
 
 		// Issue one or multiple bindDescriptorSets commands. We can only bind CONSECUTIVELY NUMBERED sets.
 		size_t descIdx = 0;
-		while (descIdx < aDescriptorSets.size()) {
-			const uint32_t setId = aDescriptorSets[descIdx].set_id();
+		while (descIdx < handles.size()) {
+			const uint32_t setId = setIds[descIdx];
 			uint32_t count = 1u;
-			while ((descIdx + count) < aDescriptorSets.size() && aDescriptorSets[descIdx + count].set_id() == (setId + count)) {
+			while ((descIdx + count) < handles.size() && setIds[descIdx + count] == (setId + count)) {
 				++count;
 			}
 
+			// The dynamic offsets of all the consecutively numbered sets are passed in one go:
+			std::vector<uint32_t> offsets;
+			for (uint32_t i = 0; i < count; ++i) {
+				offsets.insert(std::end(offsets), std::begin(dynamicOffsets[descIdx + i]), std::end(dynamicOffsets[descIdx + i]));
+			}
+
 			handle().bindDescriptorSets(
 				aBindingPoint,
 				aLayoutHandle,
 				setId, count,
 				&handles[descIdx],
-				0, // TODO: Dynamic offset count
-				nullptr); // TODO: Dynamic offset
+				static_cast<uint32_t>(offsets.size()),
+				offsets.data());
+
+			if (boundSets.size() < setId + count) {
+				boundSets.resize(setId + count);
+			}
+			for (uint32_t i = 0; i < count; ++i) {
+				boundSets[setId + i] = bound_descriptor_set{ handles[descIdx + i], std::move(dynamicOffsets[descIdx + i]) };
+			}
+
+			descIdx += count;
+		}
+	}
+
+#if VK_HEADER_VERSION >= 235
+	void command_buffer_t::bind_descriptors_from_descriptor_buffer(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, const std::vector<descriptor_set>& aDescriptorSets)
+	{
+		const auto bpi = bind_point_index(aBindingPoint);
+		auto& boundSets = mBoundState.mDescriptorSets[bpi];
+
+		// All sets of one descriptor cache live in the same descriptor buffer, which is bound at buffer index 0:
+		const auto bufferAddress = aDescriptorSets.front().descriptor_buffer_address();
+		if (!mRedundantBindFilteringEnabled || mBoundState.mDescriptorBufferAddress != bufferAddress) {
+			handle().bindDescriptorBuffersEXT(
+				vk::DescriptorBufferBindingInfoEXT{}
+					.setAddress(bufferAddress)
+					.setUsage(vk::BufferUsageFlagBits::eResourceDescriptorBufferEXT | vk::BufferUsageFlagBits::eSamplerDescriptorBufferEXT),
+				root_ptr()->dispatch_loader_ext()
+			);
+			mBoundState.mDescriptorBufferAddress = bufferAddress;
+			for (auto& bpSets : mBoundState.mDescriptorSets) {
+				bpSets.clear();
+			}
+		}
+		if (mBoundState.mDescriptorSetsLayouts[bpi] != aLayoutHandle) {
+			boundSets.clear();
+			mBoundState.mDescriptorSetsLayouts[bpi] = aLayoutHandle;
+		}
+
+		std::vector<vk::DeviceSize> offsets;
+		std::vector<uint32_t> setIds;
+		offsets.reserve(aDescriptorSets.size());
+		setIds.reserve(aDescriptorSets.size());
+		for (const auto& dset : aDescriptorSets) {
+			if (!dset.is_in_descriptor_buffer() || dset.descriptor_buffer_address() != bufferAddress) {
+				throw avk::logic_error("All descriptor sets passed to bind_descriptors must reside in the same descriptor buffer.");
+			}
+			// Skip sets which are bound to the same set index with the same offset already:
+			if (mRedundantBindFilteringEnabled && dset.set_id() < boundSets.size() && boundSets[dset.set_id()].mDescriptorBufferOffset == dset.descriptor_buffer_offset()) {
+				++mElidedBinds.mDescriptorSets;
+				continue;
+			}
+			offsets.push_back(dset.descriptor_buffer_offset());
+			setIds.push_back(dset.set_id());
+		}
+
+		// Issue one or multiple setDescriptorBufferOffsets commands. We can only set CONSECUTIVELY NUMBERED sets.
+		const std::vector<uint32_t> bufferIndices(offsets.size(), 0u);
+		size_t descIdx = 0;
+		while (descIdx < offsets.size()) {
+			const uint32_t setId = setIds[descIdx];
+			uint32_t count = 1u;
+			while ((descIdx + count) < offsets.size() && setIds[descIdx + count] == (setId + count)) {
+				++count;
+			}
+
+			handle().setDescriptorBufferOffsetsEXT(
+				aBindingPoint,
+				aLayoutHandle,
+				setId, count,
+				&bufferIndices[descIdx],
+				&offsets[descIdx],
+				root_ptr()->dispatch_loader_ext());
+
+			if (boundSets.size() < setId + count) {
+				boundSets.resize(setId + count);
+			}
+			for (uint32_t i = 0; i < count; ++i) {
+				boundSets[setId + i] = bound_descriptor_set{ vk::DescriptorSet{}, {}, offsets[descIdx + i] };
+			}
 
 			descIdx += count;
 		}
 	}
+#endif
+
+	void command_buffer_t::push_descriptors(vk::PipelineBindPoint aBindingPoint, vk::PipelineLayout aLayoutHandle, descriptor_set aPreparedSet)
+	{
+		// The stored descriptor infos might have moved => point the writes to their current location:
+		aPreparedSet.update_data_pointers();
+		handle().pushDescriptorSetKHR(
+			aBindingPoint,
+			aLayoutHandle,
+			aPreparedSet.set_id(),
+			static_cast<uint32_t>(aPreparedSet.number_of_writes()),
+			aPreparedSet.writes_data_ptr(),
+			root_ptr()->dispatch_loader_ext()
+		);
+
+		// Whatever has been bound to this set index before, has been replaced:
+		const auto bpi = bind_point_index(aBindingPoint);
+		auto& boundSets = mBoundState.mDescriptorSets[bpi];
+		if (mBoundState.mDescriptorSetsLayouts[bpi] != aLayoutHandle) {
+			boundSets.clear();
+			mBoundState.mDescriptorSetsLayouts[bpi] = aLayoutHandle;
+		}
+		if (aPreparedSet.set_id() < boundSets.size()) {
+			boundSets[aPreparedSet.set_id()] = bound_descriptor_set{};
+		}
+	}
+
+	void command_buffer_t::bind_pipeline(vk::PipelineBindPoint aBindingPoint, vk::Pipeline aPipelineHandle, vk::PipelineLayout aLayoutHandle)
+	{
+		auto& boundPipeline = mBoundState.mPipelines[bind_point_index(aBindingPoint)];
+		if (mRedundantBindFilteringEnabled && boundPipeline == aPipelineHandle) {
+			++mElidedBinds.mPipelines;
+			return;
+		}
+
+		handle().bindPipeline(aBindingPoint, aPipelineHandle);
+		boundPipeline = aPipelineHandle;
+		if (mBoundState.mPushConstantsLayout != aLayoutHandle) {
+			// Don't rely on push constants which have been pushed for a different layout:
+			mBoundState.mPushConstants.clear();
+		}
+	}
+
+	void command_buffer_t::bind_vertex_buffers(uint32_t aFirstBinding, uint32_t aBindingCount, const vk::Buffer* aBuffers, const vk::DeviceSize* aOffsets)
+	{
+		auto& boundBuffers = mBoundState.mVertexBuffers;
+		auto& boundOffsets = mBoundState.mVertexBufferOffsets;
+		if (boundBuffers.size() < aFirstBinding + aBindingCount) {
+			boundBuffers.resize(aFirstBinding + aBindingCount);
+			boundOffsets.resize(aFirstBinding + aBindingCount);
+		}
+
+		// Only bind the range [begin, end), outside of which everything is bound already:
+		uint32_t begin = 0u;
+		uint32_t end = aBindingCount;
+		if (mRedundantBindFilteringEnabled) {
+			while (begin < end && boundBuffers[aFirstBinding + begin] == aBuffers[begin] && boundOffsets[aFirstBinding + begin] == aOffsets[begin]) {
+				++begin;
+			}
+			while (end > begin && boundBuffers[aFirstBinding + end - 1] == aBuffers[end - 1] && boundOffsets[aFirstBinding + end - 1] == aOffsets[end - 1]) {
+				--end;
+			}
+			mElidedBinds.mVertexBuffers += aBindingCount - (end - begin);
+			if (begin == end) {
+				return;
+			}
+		}
+
+		handle().bindVertexBuffers(aFirstBinding + begin, end - begin, aBuffers + begin, aOffsets + begin);
+		std::copy(aBuffers + begin, aBuffers + end, boundBuffers.begin() + aFirstBinding + begin);
+		std::copy(aOffsets + begin, aOffsets + end, boundOffsets.begin() + aFirstBinding + begin);
+	}
+
+	void command_buffer_t::bind_index_buffer(vk::Buffer aBuffer, vk::DeviceSize aOffset, vk::IndexType aIndexType)
+	{
+		if (mRedundantBindFilteringEnabled && mBoundState.mIndexBuffer == aBuffer && mBoundState.mIndexBufferOffset == aOffset && mBoundState.mIndexType == aIndexType) {
+			++mElidedBinds.mIndexBuffers;
+			return;
+		}
+
+		handle().bindIndexBuffer(aBuffer, aOffset, aIndexType);
+		mBoundState.mIndexBuffer = aBuffer;
+		mBoundState.mIndexBufferOffset = aOffset;
+		mBoundState.mIndexType = aIndexType;
+	}
+
+	void command_buffer_t::push_constants(vk::PipelineLayout aLayoutHandle, vk::ShaderStageFlags aStageFlags, uint32_t aOffset, uint32_t aSize, const void* aValues)
+	{
+		auto& pushed = mBoundState.mPushConstants;
+		if (mBoundState.mPushConstantsLayout != aLayoutHandle) {
+			pushed.clear();
+			mBoundState.mPushConstantsLayout = aLayoutHandle;
+		}
+
+		const auto* values = static_cast<const uint8_t*>(aValues);
+		auto isSameRange = [aStageFlags, aOffset, aSize](const pushed_constants& pc) {
+			return pc.mStageFlags == aStageFlags && pc.mOffset == aOffset && pc.mValues.size() == aSize;
+		};
+		auto it = std::find_if(std::begin(pushed), std::end(pushed), isSameRange);
+		if (mRedundantBindFilteringEnabled && it != std::end(pushed) && std::equal(values, values + aSize, std::begin(it->mValues))) {
+			++mElidedBinds.mPushConstants;
+			return;
+		}
+
+		handle().pushConstants(aLayoutHandle, aStageFlags, aOffset, aSize, aValues);
+
+		if (it != std::end(pushed)) {
+			std::copy(values, values + aSize, std::begin(it->mValues));
+		}
+		else {
+			pushed.push_back(pushed_constants{ aStageFlags, aOffset, std::vector<uint8_t>(values, values + aSize) });
+		}
+		// Forget about all the other ranges which have been (partially) overwritten:
+		std::erase_if(pushed, [&isSameRange, aStageFlags, aOffset, aSize](const pushed_constants& pc) {
+			return !isSameRange(pc)
+				&& static_cast<bool>(pc.mStageFlags & aStageFlags)
+				&& pc.mOffset < aOffset + aSize && aOffset < pc.mOffset + static_cast<uint32_t>(pc.mValues.size());
+		});
+	}
+
+	void command_buffer_t::invalidate_bound_state()
+	{
+		mBoundState = {};
+	}
+
+	size_t command_buffer_t::bind_point_index(vk::PipelineBindPoint aBindingPoint)
+	{
+		switch (aBindingPoint) {
+		case vk::PipelineBindPoint::eGraphics:
+			return 0;
+		case vk::PipelineBindPoint::eCompute:
+			return 1;
+		default:
+			return 2;
+		}
+	}
 #pragma endregion
 
 #pragma region compute pipeline definitions
@@ -2994,10 +3431,15 @@ namespace avk
 		if ((aConfig.mPipelineSettings & cfg::pipeline_settings::disable_optimization) == cfg::pipeline_settings::disable_optimization) {
 			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDisableOptimization;
 		}
+#if VK_HEADER_VERSION >= 235
+		if (avk::descriptor_backend::descriptor_buffer == descriptor_backend_in_use()) {
+			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDescriptorBufferEXT;
+		}
+#endif
 
 		// 3. Compile the PIPELINE LAYOUT data and create-info
 		// Get the descriptor set layouts
-		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings));
+		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings), aConfig.mPushDescriptorSetId, aConfig.mDescriptorSetLayoutFlags);
 		allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts);
 
 		// Gather the push constant data
@@ -3111,7 +3553,7 @@ namespace avk
 #pragma endregion
 
 #pragma region descriptor pool definitions
-	descriptor_pool root::create_descriptor_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets)
+	descriptor_pool root::create_descriptor_pool(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets, vk::DescriptorPoolCreateFlags aFlags)
 	{
 		descriptor_pool result;
 		result.mInitialCapacities = aSizeRequirements;
@@ -3124,7 +3566,7 @@ namespace avk
 			.setPoolSizeCount(static_cast<uint32_t>(result.mInitialCapacities.size()))
 			.setPPoolSizes(result.mInitialCapacities.data())
 			.setMaxSets(aNumSets)
-			.setFlags(vk::DescriptorPoolCreateFlags()); // The structure has an optional flag similar to command pools that determines if individual descriptor sets can be freed or not: VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT. We're not going to touch the descriptor set after creating it, so we don't need this flag. [10]
+			.setFlags(aFlags); // The structure has an optional flag similar to command pools that determines if individual descriptor sets can be freed or not: VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT. We're not going to touch the descriptor set after creating it, so we don't need this flag. [10]
 		result.mDescriptorPool = aDevice.createDescriptorPoolUnique(createInfo, nullptr, aDispatchLoader);
 
 		AVK_LOG_DEBUG("Allocated pool with flags[" + vk::to_string(createInfo.flags) + "], maxSets[" + std::to_string(createInfo.maxSets) + "], remaining-sets[" + std::to_string(result.mNumRemainingSets) + "], size-entries[" + std::to_string(createInfo.poolSizeCount) + "]");
@@ -3137,9 +3579,9 @@ namespace avk
 		return result;
 	}
 
-	descriptor_pool root::create_descriptor_pool(const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets)
+	descriptor_pool root::create_descriptor_pool(const std::vector<vk::DescriptorPoolSize>& aSizeRequirements, int aNumSets, vk::DescriptorPoolCreateFlags aFlags)
 	{
-		return create_descriptor_pool(device(), dispatch_loader_core(), aSizeRequirements, aNumSets);
+		return create_descriptor_pool(device(), dispatch_loader_core(), aSizeRequirements, aNumSets, aFlags);
 	}
 
 	bool descriptor_pool::has_capacity_for(const descriptor_alloc_request& pRequest) const
@@ -3244,6 +3686,22 @@ namespace avk
 		mNumRemainingSets = mNumInitialSets;
 	}
 
+	void descriptor_pool::free(const std::vector<vk::DescriptorSet>& aSets, const std::vector<vk::DescriptorPoolSize>& aSizes)
+	{
+		mDescriptorPool.getOwner().freeDescriptorSets(mDescriptorPool.get(), aSets);
+
+		// Update the pool's stats:
+		for (const auto& dps : aSizes) {
+			auto it = std::find_if(std::begin(mRemainingCapacities), std::end(mRemainingCapacities), [&dps](vk::DescriptorPoolSize& el){
+				return el.type == dps.type;
+			});
+			if (std::end(mRemainingCapacities) != it) {
+				it->descriptorCount += dps.descriptorCount;
+			}
+		}
+		mNumRemainingSets = std::min(mNumRemainingSets + static_cast<int>(aSets.size()), mNumInitialSets);
+	}
+
 	descriptor_cache root::create_descriptor_cache(std::string aName)
 	{
 		if (aName.empty()) {
@@ -3254,6 +3712,7 @@ namespace avk
 		descriptor_cache_t result;
 		result.mName = std::move(aName);
 		result.mRoot = this;
+		result.mState = std::make_unique<descriptor_cache_t::state>();
 		return result;
 	}
 #pragma endregion
@@ -3261,6 +3720,9 @@ namespace avk
 #pragma region descriptor set layout definitions
 
 	bool operator ==(const descriptor_set_layout& left, const descriptor_set_layout& right) {
+		if (left.mCreateFlags != right.mCreateFlags || left.mBindingFlags != right.mBindingFlags) {
+			return false;
+		}
 		const auto n = left.mOrderedBindings.size();
 		if (n != right.mOrderedBindings.size()) {
 			return false;
@@ -3282,8 +3744,16 @@ namespace avk
 		if (!aLayoutToBeAllocated.mLayout) {
 			// Allocate the layout and return the result:
 			auto createInfo = vk::DescriptorSetLayoutCreateInfo()
+				.setFlags(aLayoutToBeAllocated.mCreateFlags)
 				.setBindingCount(static_cast<uint32_t>(aLayoutToBeAllocated.mOrderedBindings.size()))
 				.setPBindings(aLayoutToBeAllocated.mOrderedBindings.data());
+			auto bindingFlagsInfo = vk::DescriptorSetLayoutBindingFlagsCreateInfo{}
+				.setBindingCount(static_cast<uint32_t>(aLayoutToBeAllocated.mBindingFlags.size()))
+				.setPBindingFlags(aLayoutToBeAllocated.mBindingFlags.data());
+			if (!aLayoutToBeAllocated.mBindingFlags.empty()) {
+				assert(aLayoutToBeAllocated.mBindingFlags.size() == aLayoutToBeAllocated.mOrderedBindings.size());
+				createInfo.setPNext(&bindingFlagsInfo);
+			}
 			aLayoutToBeAllocated.mLayout = aDevice.createDescriptorSetLayoutUnique(createInfo, nullptr, aDispatchLoader);
 		}
 		else {
@@ -3296,16 +3766,83 @@ namespace avk
 		return allocate_descriptor_set_layout(device(), dispatch_loader_core(), aLayoutToBeAllocated);
 	}
 
+	size_t descriptor_set_layout::descriptor_data_size(vk::DescriptorType aType)
+	{
+		switch (aType) {
+		case vk::DescriptorType::eSampler:
+		case vk::DescriptorType::eCombinedImageSampler:
+		case vk::DescriptorType::eSampledImage:
+		case vk::DescriptorType::eStorageImage:
+		case vk::DescriptorType::eInputAttachment:
+			return sizeof(vk::DescriptorImageInfo);
+		case vk::DescriptorType::eUniformTexelBuffer:
+		case vk::DescriptorType::eStorageTexelBuffer:
+			return sizeof(vk::BufferView);
+		case vk::DescriptorType::eUniformBuffer:
+		case vk::DescriptorType::eStorageBuffer:
+		case vk::DescriptorType::eUniformBufferDynamic:
+		case vk::DescriptorType::eStorageBufferDynamic:
+			return sizeof(vk::DescriptorBufferInfo);
+#if VK_HEADER_VERSION >= 135
+		case vk::DescriptorType::eAccelerationStructureKHR:
+			return sizeof(vk::AccelerationStructureKHR);
+#endif
+		default:
+			return 0;
+		}
+	}
+
+	void root::allocate_descriptor_update_template(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, descriptor_set_layout& aAllocatedLayout)
+	{
+		assert(aAllocatedLayout.mLayout);
+		if (aAllocatedLayout.mUpdateTemplate) {
+			AVK_LOG_ERROR("descriptor_set_layout's update template already has a value => it has already been allocated. Won't do it again.");
+			return;
+		}
+		if (aAllocatedLayout.is_for_push_descriptors() || aAllocatedLayout.mOrderedBindings.empty()) {
+			return;
+		}
+#if VK_HEADER_VERSION >= 235
+		if (aAllocatedLayout.mCreateFlags & vk::DescriptorSetLayoutCreateFlagBits::eDescriptorBufferEXT) {
+			return; // Not written through vkUpdateDescriptorSet* at all
+		}
+#endif
+
+		// Each binding's descriptor data is stored tightly packed after the previous binding's data:
+		std::vector<vk::DescriptorUpdateTemplateEntry> entries;
+		size_t offset = 0;
+		for (const auto& b : aAllocatedLayout.mOrderedBindings) {
+			const auto stride = descriptor_set_layout::descriptor_data_size(b.descriptorType);
+			if (0 == stride) {
+				// Not supported => descriptor_set::write_descriptors falls back to vkUpdateDescriptorSets
+				return;
+			}
+			entries.emplace_back(b.binding, 0u, b.descriptorCount, b.descriptorType, offset, stride);
+			offset += stride * b.descriptorCount;
+		}
+
+		auto createInfo = vk::DescriptorUpdateTemplateCreateInfo{}
+			.setDescriptorUpdateEntryCount(static_cast<uint32_t>(entries.size()))
+			.setPDescriptorUpdateEntries(entries.data())
+			.setTemplateType(vk::DescriptorUpdateTemplateType::eDescriptorSet)
+			.setDescriptorSetLayout(aAllocatedLayout.handle());
+		aAllocatedLayout.mUpdateTemplate = aDevice.createDescriptorUpdateTemplateUnique(createInfo, nullptr, aDispatchLoader);
+		aAllocatedLayout.mUpdateTemplateEntries = std::move(entries);
+		aAllocatedLayout.mUpdateTemplateDataSize = offset;
+	}
+
 	descriptor_set_layout root::create_descriptor_set_layout_from_template(const descriptor_set_layout& aTemplate)
 	{
 		descriptor_set_layout result;
 		result.mBindingRequirements = aTemplate.mBindingRequirements;
 		result.mOrderedBindings = aTemplate.mOrderedBindings;
+		result.mCreateFlags = aTemplate.mCreateFlags;
+		result.mBindingFlags = aTemplate.mBindingFlags;
 		allocate_descriptor_set_layout(result);
 		return result;
 	}
 
-	set_of_descriptor_set_layouts set_of_descriptor_set_layouts::prepare(std::vector<binding_data> pBindings)
+	set_of_descriptor_set_layouts set_of_descriptor_set_layouts::prepare(std::vector<binding_data> pBindings, std::optional<uint32_t> pPushDescriptorSetId, const std::vector<descriptor_set_layout_flags>& pLayoutFlags)
 	{
 		set_of_descriptor_set_layouts result;
 		std::vector<binding_data> orderedBindings;
@@ -3334,6 +3871,25 @@ namespace avk
 				});
 			// For empty sets, lb==ub, which means no descriptors will be regarded. This should be fine.
 			result.mLayouts.push_back(descriptor_set_layout::prepare(lb, ub));
+			if (pPushDescriptorSetId.has_value() && pPushDescriptorSetId.value() == setId) {
+				result.mLayouts.back().set_create_flags(vk::DescriptorSetLayoutCreateFlagBits::ePushDescriptorKHR);
+			}
+		}
+		if (pPushDescriptorSetId.has_value() && (pBindings.empty() || pPushDescriptorSetId.value() > maxSetId)) {
+			throw avk::logic_error("There are no bindings for the push descriptor set with set-id " + std::to_string(pPushDescriptorSetId.value()) + ".");
+		}
+		for (const auto& lf : pLayoutFlags) {
+			if (pBindings.empty() || lf.mSetId > maxSetId) {
+				throw avk::logic_error("There are no bindings for the descriptor set with set-id " + std::to_string(lf.mSetId) + ", for which layout flags have been specified.");
+			}
+			auto& dsl = result.mLayouts[lf.mSetId];
+			dsl.set_create_flags(dsl.create_flags() | lf.mCreateFlags);
+			if (!lf.mBindingFlags.empty()) {
+				if (lf.mBindingFlags.size() != dsl.number_of_bindings()) {
+					throw avk::logic_error("The number of binding flags (" + std::to_string(lf.mBindingFlags.size()) + ") does not match the number of bindings (" + std::to_string(dsl.number_of_bindings()) + ") of the descriptor set with set-id " + std::to_string(lf.mSetId) + ".");
+				}
+				dsl.set_binding_flags(lf.mBindingFlags);
+			}
 		}
 
 		// Step 3: Accumulate the binding requirements a.k.a. vk::DescriptorPoolSize entries
@@ -3363,6 +3919,18 @@ namespace avk
 	void root::allocate_set_of_descriptor_set_layouts(set_of_descriptor_set_layouts& aLayoutsToBeAllocated)
 	{
 		for (auto& dsl : aLayoutsToBeAllocated.mLayouts) {
+#if VK_HEADER_VERSION >= 235
+			if (avk::descriptor_backend::descriptor_buffer == descriptor_backend_in_use()) {
+				// Descriptor buffer layouts must not be combined with these, and command_buffer binds all sets from the descriptor buffer:
+				if (dsl.is_for_push_descriptors()) {
+					throw avk::logic_error("Push descriptor sets are not supported under the descriptor_buffer backend.");
+				}
+				if (dsl.create_flags() & vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool) {
+					throw avk::logic_error("Update-after-bind descriptor set layouts are not supported under the descriptor_buffer backend.");
+				}
+				dsl.set_create_flags(dsl.create_flags() | vk::DescriptorSetLayoutCreateFlagBits::eDescriptorBufferEXT);
+			}
+#endif
 			allocate_descriptor_set_layout(dsl);
 		}
 	}
@@ -3393,24 +3961,56 @@ namespace avk
 
 	const descriptor_set_layout& descriptor_cache_t::get_or_alloc_layout(descriptor_set_layout aPreparedLayout)
 	{
-		const auto it = mLayouts.find(aPreparedLayout);
-		if (mLayouts.end() != it) {
-			assert(it->handle());
+#if VK_HEADER_VERSION >= 235
+		if (avk::descriptor_backend::descriptor_buffer == mRoot->descriptor_backend_in_use()) {
+			aPreparedLayout.set_create_flags(aPreparedLayout.create_flags() | vk::DescriptorSetLayoutCreateFlagBits::eDescriptorBufferEXT);
+		}
+#endif
+		{
+			std::shared_lock lock(mState->mLayoutsMutex);
+			const auto it = mState->mLayouts.find(aPreparedLayout);
+			if (mState->mLayouts.end() != it) {
+				assert(it->handle());
+				return *it; // Elements of an unordered_set stay where they are when other elements are inserted
+			}
+		}
+
+		std::unique_lock lock(mState->mLayoutsMutex);
+		// Another thread might have allocated it in the meantime:
+		const auto it = mState->mLayouts.find(aPreparedLayout);
+		if (mState->mLayouts.end() != it) {
 			return *it;
 		}
 
 		root::allocate_descriptor_set_layout(mRoot->device(), mRoot->dispatch_loader_core(), aPreparedLayout);
+		root::allocate_descriptor_update_template(mRoot->device(), mRoot->dispatch_loader_core(), aPreparedLayout);
 
-		const auto result = mLayouts.insert(std::move(aPreparedLayout));
+		const auto result = mState->mLayouts.insert(std::move(aPreparedLayout));
 		assert(result.second);
 		return *result.first;
 	}
 
 	std::optional<descriptor_set> descriptor_cache_t::get_descriptor_set_from_cache(const descriptor_set& aPreparedSet)
 	{
-		const auto it = mSets.find(aPreparedSet);
-		if (mSets.end() != it) {
-			auto found = *it;
+		auto found = find_in_cache(aPreparedSet);
+		auto& shard = shard_for(aPreparedSet.hash());
+		if (found.has_value()) {
+			shard.mNumHits.fetch_add(1, std::memory_order_relaxed);
+		}
+		else {
+			shard.mNumMisses.fetch_add(1, std::memory_order_relaxed);
+		}
+		return found;
+	}
+
+	std::optional<descriptor_set> descriptor_cache_t::find_in_cache(const descriptor_set& aPreparedSet)
+	{
+		auto& shard = shard_for(aPreparedSet.hash());
+		std::shared_lock lock(shard.mMutex);
+		const auto it = shard.mSets.find(aPreparedSet);
+		if (shard.mSets.end() != it) {
+			it->second.mLastUsedFrame.store(mState->mCurrentFrameId.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			auto found = it->first.reference_copy();
 			// This might not be the veeeery best place to alter the set-id, but let's go for it:
 			found.set_set_id(aPreparedSet.set_id());
 			return found;
@@ -3418,33 +4018,213 @@ namespace avk
 		return {};
 	}
 
-	std::vector<descriptor_set> descriptor_cache_t::alloc_new_descriptor_sets(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts, std::vector<descriptor_set> aPreparedSets)
+	std::optional<descriptor_set> descriptor_cache_t::find_in_cache(const binding_data* aBegin, const binding_data* aEnd)
 	{
-		assert(aLayouts.size() == aPreparedSets.size());
+		const auto key = bindings_key{ descriptor_set::hash_of(aBegin, aEnd), aBegin, aEnd };
+		auto& shard = shard_for(key.mHash);
+		std::shared_lock lock(shard.mMutex);
+		const auto it = shard.mSets.find(key);
+		if (shard.mSets.end() == it) {
+			shard.mNumMisses.fetch_add(1, std::memory_order_relaxed);
+			return {};
+		}
+		it->second.mLastUsedFrame.store(mState->mCurrentFrameId.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		shard.mNumHits.fetch_add(1, std::memory_order_relaxed);
+		// Do not copy the cached set's descriptor data, which would allocate on every hit:
+		auto found = it->first.reference_copy();
+		found.set_set_id(aBegin->mSetId);
+		return found;
+	}
 
-		std::vector<descriptor_set> result;
-		if (aLayouts.empty()) {
-			return result;
+	descriptor_set descriptor_cache_t::insert_into_cache(descriptor_set aSet)
+	{
+		auto& shard = shard_for(aSet.hash());
+		std::unique_lock lock(shard.mMutex);
+		// If another thread has allocated the same set concurrently, the first one wins and this set's handle is just not used anymore:
+		const auto inserted = shard.mSets.try_emplace(std::move(aSet));
+		if (inserted.second) {
+			add_to_reverse_index(shard, inserted.first->first);
 		}
+		inserted.first->second.mLastUsedFrame.store(mState->mCurrentFrameId.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		return inserted.first->first.reference_copy();
+	}
 
-		const int n = static_cast<int>(aLayouts.size());
-#ifdef _DEBUG // Perform an extensive sanity check:
-		for (int i = 0; i < n; ++i) {
-			const auto dbgB = aLayouts[i].get().number_of_bindings();
-			assert(dbgB == aPreparedSets[i].number_of_writes());
-			for (size_t j = 0; j < dbgB; ++j) {
-				assert(aLayouts[i].get().binding_at(j).binding			== aPreparedSets[i].write_at(j).dstBinding);
-				assert(aLayouts[i].get().binding_at(j).descriptorCount	== aPreparedSets[i].write_at(j).descriptorCount);
-				assert(aLayouts[i].get().binding_at(j).descriptorType	== aPreparedSets[i].write_at(j).descriptorType);
-			}
+	void descriptor_cache_t::set_capacity(size_t aMaxNumSets, uint32_t aNumFramesInFlight)
+	{
+		mCapacity = aMaxNumSets;
+		mNumFramesInFlight = std::max(aNumFramesInFlight, 1u);
+	}
+
+	void descriptor_cache_t::begin_frame(int64_t aFrameId)
+	{
+		mState->mCurrentFrameId.store(aFrameId, std::memory_order_relaxed);
+		// Descriptor buffer space is never reclaimed => evicting sets would only make the buffer run full sooner:
+		if (avk::descriptor_backend::descriptor_buffer == mRoot->descriptor_backend_in_use()) {
+			return;
 		}
-#endif
 
-		// Find possible duplicates within the descriptor sets, and store the unique layouts so that we do not over-allocate:
-		std::vector<std::reference_wrapper<const descriptor_set_layout>> layoutsOfUniqueSets;
-		std::vector<int> duplicateSetIndices; // -1 ... no duplicate, [0..n) ... duplicate at the given index
-		layoutsOfUniqueSets.push_back(aLayouts[0]);
-		duplicateSetIndices.emplace_back(-1);
+		mState->mTracksFrames.store(true, std::memory_order_relaxed);
+		if (0 != mCapacity) {
+			evict_least_recently_used_sets(aFrameId);
+		}
+		free_retired_sets_and_sweep_pools(aFrameId);
+	}
+
+	void descriptor_cache_t::evict_least_recently_used_sets(int64_t aFrameId)
+	{
+		// Eviction has to see all the shards at once:
+		std::vector<std::unique_lock<std::shared_mutex>> locks;
+		locks.reserve(sNumSetShards);
+		size_t numSets = 0;
+		for (auto& shard : mState->mSetShards) {
+			locks.emplace_back(shard.mMutex);
+			numSets += shard.mSets.size();
+		}
+		if (numSets <= mCapacity) {
+			return;
+		}
+
+		// Only sets which no frame in flight might still use are candidates for eviction:
+		const int64_t lastRetiredFrame = aFrameId - static_cast<int64_t>(mNumFramesInFlight);
+		using set_iterator = set_map::iterator;
+		std::vector<std::tuple<int64_t, size_t, set_iterator>> candidates;
+		for (size_t si = 0; si < sNumSetShards; ++si) {
+			auto& sets = mState->mSetShards[si].mSets;
+			for (auto it = std::begin(sets); it != std::end(sets); ++it) {
+				const auto lastUsed = it->second.mLastUsedFrame.load(std::memory_order_relaxed);
+				if (lastUsed <= lastRetiredFrame) {
+					candidates.emplace_back(lastUsed, si, it);
+				}
+			}
+		}
+
+		const auto numToEvict = std::min(numSets - mCapacity, candidates.size());
+		if (numToEvict < candidates.size()) {
+			std::nth_element(std::begin(candidates), std::begin(candidates) + numToEvict, std::end(candidates), [](const auto& a, const auto& b) {
+				return std::get<int64_t>(a) < std::get<int64_t>(b);
+			});
+		}
+		// Evicted sets are retired, and freed by free_retired_sets_and_sweep_pools:
+		for (size_t i = 0; i < numToEvict; ++i) {
+			erase_from_shard(mState->mSetShards[std::get<size_t>(candidates[i])], std::get<set_iterator>(candidates[i]));
+		}
+		mState->mNumEvictions.fetch_add(numToEvict, std::memory_order_relaxed);
+	}
+
+	void descriptor_cache_t::free_retired_sets_and_sweep_pools(int64_t aFrameId)
+	{
+		// Sets which have last been used by one of the frames which might still be in flight must stay valid:
+		const int64_t lastRetiredFrame = aFrameId - static_cast<int64_t>(mNumFramesInFlight);
+		std::vector<retired_set> toBeFreed;
+		{
+			std::scoped_lock lock{ mState->mRetiredSetsMutex };
+			auto it = std::partition(std::begin(mState->mRetiredSets), std::end(mState->mRetiredSets), [lastRetiredFrame](const retired_set& lRetired) {
+				return lRetired.mLastUsedFrame > lastRetiredFrame;
+			});
+			std::move(it, std::end(mState->mRetiredSets), std::back_inserter(toBeFreed));
+			mState->mRetiredSets.erase(it, std::end(mState->mRetiredSets));
+		}
+
+		// No other thread must allocate from any of the pools meanwhile:
+		std::unique_lock lock(mState->mDescriptorPoolsMutex);
+		for (auto& retired : toBeFreed) {
+			retired.mSet.free_from_pool();
+		}
+
+		auto& allPools = mState->mDescriptorPools;
+		for (auto it = std::begin(allPools); it != std::end(allPools); ) {
+			auto& pools = *it->second;
+			for (auto entry = std::begin(pools); entry != std::end(pools); ) {
+				// Sets (or copies of them) which refer to a pool keep it alive:
+				if (1 != entry->mPool.use_count()) {
+					entry->mEmptySinceFrame.reset();
+					++entry;
+					continue;
+				}
+				// All of its sets have been freed (or dropped without ever being used) => start over with the full capacities:
+				if (entry->mPool->remaining_sets() != entry->mPool->initial_sets()) {
+					entry->mPool->reset();
+					entry->mPool->set_remaining_capacities(entry->mCapacities);
+					mState->mNumPoolResets.fetch_add(1, std::memory_order_relaxed);
+				}
+				if (!entry->mEmptySinceFrame.has_value()) {
+					entry->mEmptySinceFrame = aFrameId;
+				}
+				else if (aFrameId - entry->mEmptySinceFrame.value() >= static_cast<int64_t>(mNumFramesInFlight)) {
+					// Its thread has not needed it for a while (or does not exist anymore) => destroy it:
+					entry = pools.erase(entry);
+					continue;
+				}
+				++entry;
+			}
+			if (pools.empty()) {
+				it = allPools.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+
+	size_t descriptor_cache_t::number_of_cached_sets() const
+	{
+		size_t numSets = 0;
+		for (auto& shard : mState->mSetShards) {
+			std::shared_lock lock(shard.mMutex);
+			numSets += shard.mSets.size();
+		}
+		return numSets;
+	}
+
+	descriptor_cache_t::cache_statistics descriptor_cache_t::statistics() const
+	{
+		uint64_t numHits = 0;
+		uint64_t numMisses = 0;
+		for (const auto& shard : mState->mSetShards) {
+			numHits += shard.mNumHits.load(std::memory_order_relaxed);
+			numMisses += shard.mNumMisses.load(std::memory_order_relaxed);
+		}
+		return cache_statistics{
+			numHits,
+			numMisses,
+			mState->mNumEvictions.load(std::memory_order_relaxed),
+			mState->mNumPoolResets.load(std::memory_order_relaxed)
+		};
+	}
+
+	std::vector<descriptor_set> descriptor_cache_t::alloc_new_descriptor_sets(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts, std::vector<descriptor_set> aPreparedSets)
+	{
+		assert(aLayouts.size() == aPreparedSets.size());
+
+		std::vector<descriptor_set> result;
+		if (aLayouts.empty()) {
+			return result;
+		}
+
+#if VK_HEADER_VERSION >= 235
+		if (avk::descriptor_backend::descriptor_buffer == mRoot->descriptor_backend_in_use()) {
+			return write_new_descriptor_sets_into_descriptor_buffer(aLayouts, std::move(aPreparedSets));
+		}
+#endif
+
+		const int n = static_cast<int>(aLayouts.size());
+#ifdef _DEBUG // Perform an extensive sanity check:
+		for (int i = 0; i < n; ++i) {
+			const auto dbgB = aLayouts[i].get().number_of_bindings();
+			assert(dbgB == aPreparedSets[i].number_of_writes());
+			for (size_t j = 0; j < dbgB; ++j) {
+				assert(aLayouts[i].get().binding_at(j).binding			== aPreparedSets[i].write_at(j).dstBinding);
+				assert(aLayouts[i].get().binding_at(j).descriptorCount	== aPreparedSets[i].write_at(j).descriptorCount);
+				assert(aLayouts[i].get().binding_at(j).descriptorType	== aPreparedSets[i].write_at(j).descriptorType);
+			}
+		}
+#endif
+
+		// Find possible duplicates within the descriptor sets, and store the unique layouts so that we do not over-allocate:
+		std::vector<std::reference_wrapper<const descriptor_set_layout>> layoutsOfUniqueSets;
+		std::vector<int> duplicateSetIndices; // -1 ... no duplicate, [0..n) ... duplicate at the given index
+		layoutsOfUniqueSets.push_back(aLayouts[0]);
+		duplicateSetIndices.emplace_back(-1);
 		for (int i = 1; i < n; ++i) {
 			for (int j = 0; j < i; ++j) {
 				if (aPreparedSets[i] == aPreparedSets[j]) {
@@ -3466,7 +4246,9 @@ namespace avk
 		std::shared_ptr<descriptor_pool> pool = nullptr;
 		std::vector<vk::DescriptorSet> setHandles;
 
-		auto poolToTry = get_descriptor_pool_for_layouts(allocRequest);
+		// begin_frame() must not free sets from or reset this thread's pools while allocating from them:
+		auto [poolsLock, pools] = lock_pools_of_this_thread();
+		auto poolToTry = get_descriptor_pool_for_layouts(pools, allocRequest, false);
 
 		int maxTries = 3;
 		while (!pool && maxTries-- > 0) {
@@ -3484,15 +4266,16 @@ namespace avk
 				case 1:
 					AVK_LOG_INFO("Trying again with doubled size requirements...");
 					allocRequest = allocRequest.multiply_size_requirements(2u);
-					poolToTry = get_descriptor_pool_for_layouts(allocRequest);
+					poolToTry = get_descriptor_pool_for_layouts(pools, allocRequest, false);
 					break;
 				default:
 					AVK_LOG_INFO("Trying again with new pool..."); // and possibly doubled size requirements, depending on whether maxTries is 2 or 0
-					poolToTry = get_descriptor_pool_for_layouts(allocRequest, true);
+					poolToTry = get_descriptor_pool_for_layouts(pools, allocRequest, true);
 					break;
 				}
 			}
 		}
+		poolsLock.unlock();
 
 		assert(pool);
 		assert(setHandles.size() > 0);
@@ -3506,14 +4289,11 @@ namespace avk
 				assert(setIndex == i);
 				auto& setToBeCompleted = aPreparedSets[setIndex];
 				setToBeCompleted.link_to_handle_and_pool(std::move(setHandles[setIndex]), pool);
-				setToBeCompleted.update_data_pointers();
-				setToBeCompleted.write_descriptors();
+				// The template path reads the stored infos directly; only the fallback resolves the write pointers:
+				setToBeCompleted.write_descriptors(aLayouts[setIndex].get());
 
 				// Your soul... is mine:
-				const auto cachedSet = mSets.insert(std::move(setToBeCompleted));
-				assert(cachedSet.second); // This must not happen. Duplicate handling should have caught such cases.
-				// Done. Store for result:
-				result.push_back(*cachedSet.first); // Make a copy!
+				result.push_back(insert_into_cache(std::move(setToBeCompleted)));
 			}
 			else {
 				assert(setIndex < i);
@@ -3524,30 +4304,192 @@ namespace avk
 		return result;
 	}
 
+#if VK_HEADER_VERSION >= 235
+	std::vector<descriptor_set> descriptor_cache_t::write_new_descriptor_sets_into_descriptor_buffer(const std::vector<std::reference_wrapper<const descriptor_set_layout>>& aLayouts, std::vector<descriptor_set> aPreparedSets)
+	{
+		// The descriptor buffer is shared between all threads:
+		std::lock_guard<std::mutex> storageLock(mState->mDescriptorBufferMutex);
+		if (!mDescriptorBufferStorage) {
+			auto storage = std::make_unique<descriptor_buffer_storage>();
+			auto props2 = vk::PhysicalDeviceProperties2{};
+			props2.pNext = &storage->mProperties;
+			mRoot->physical_device().getProperties2(&props2);
+			storage->mBuffer = root::create_buffer(
+				*mRoot,
+				memory_usage::host_coherent,
+				vk::BufferUsageFlagBits::eResourceDescriptorBufferEXT | vk::BufferUsageFlagBits::eSamplerDescriptorBufferEXT | vk::BufferUsageFlagBits::eShaderDeviceAddress,
+				generic_buffer_meta::create_from_size(static_cast<size_t>(mDescriptorBufferSize))
+			);
+			// Keep it mapped for the whole lifetime of the cache:
+			storage->mMapping.emplace(storage->mBuffer->map_memory(mapping_access::write));
+			mDescriptorBufferStorage = std::move(storage);
+		}
+		auto& storage = *mDescriptorBufferStorage;
+		const auto& device = mRoot->device();
+		const auto alignment = std::max(storage.mProperties.descriptorBufferOffsetAlignment, vk::DeviceSize{ 1 });
+
+		std::vector<descriptor_set> result;
+		for (size_t i = 0; i < aPreparedSets.size(); ++i) {
+			// Duplicates within the same request are found in the cache, since their originals have been inserted already:
+			auto cachedSet = find_in_cache(aPreparedSets[i]);
+			if (cachedSet.has_value()) {
+				result.push_back(std::move(cachedSet.value()));
+				continue;
+			}
+
+			const auto layoutHandle = aLayouts[i].get().handle();
+			const auto setSize = device.getDescriptorSetLayoutSizeEXT(layoutHandle, mRoot->dispatch_loader_ext());
+			const auto offset = (storage.mNextOffset + alignment - 1) / alignment * alignment;
+			if (offset + setSize > storage.mBuffer->create_info().size) {
+				throw avk::runtime_error("The descriptor buffer of descriptor cache '" + mName + "' is exhausted. Increase its size with set_descriptor_buffer_size.");
+			}
+			storage.mNextOffset = offset + setSize;
+
+			auto& setToBeCompleted = aPreparedSets[i];
+			setToBeCompleted.update_data_pointers();
+			setToBeCompleted.link_to_descriptor_buffer(storage.mBuffer->device_address(), offset);
+			auto* setData = static_cast<uint8_t*>(storage.mMapping->get()) + offset;
+			for (size_t wi = 0; wi < setToBeCompleted.number_of_writes(); ++wi) {
+				const auto& w = setToBeCompleted.write_at(wi);
+				const auto bindingOffset = device.getDescriptorSetLayoutBindingOffsetEXT(layoutHandle, w.dstBinding, mRoot->dispatch_loader_ext());
+				const auto descriptorSize = descriptor_buffer_descriptor_size(storage.mProperties, w.descriptorType);
+				for (uint32_t e = 0; e < w.descriptorCount; ++e) {
+					write_descriptor_into_descriptor_buffer(w, e, setData + bindingOffset + (w.dstArrayElement + e) * descriptorSize, descriptorSize);
+				}
+			}
+
+			result.push_back(insert_into_cache(std::move(setToBeCompleted)));
+		}
+		return result;
+	}
+
+	size_t descriptor_cache_t::descriptor_buffer_descriptor_size(const vk::PhysicalDeviceDescriptorBufferPropertiesEXT& aProperties, vk::DescriptorType aType)
+	{
+		switch (aType) {
+		case vk::DescriptorType::eSampler:				return aProperties.samplerDescriptorSize;
+		case vk::DescriptorType::eCombinedImageSampler:	return aProperties.combinedImageSamplerDescriptorSize;
+		case vk::DescriptorType::eSampledImage:			return aProperties.sampledImageDescriptorSize;
+		case vk::DescriptorType::eStorageImage:			return aProperties.storageImageDescriptorSize;
+		case vk::DescriptorType::eInputAttachment:		return aProperties.inputAttachmentDescriptorSize;
+		case vk::DescriptorType::eUniformBuffer:		return aProperties.uniformBufferDescriptorSize;
+		case vk::DescriptorType::eStorageBuffer:		return aProperties.storageBufferDescriptorSize;
+		case vk::DescriptorType::eUniformTexelBuffer:	return aProperties.uniformTexelBufferDescriptorSize;
+		case vk::DescriptorType::eStorageTexelBuffer:	return aProperties.storageTexelBufferDescriptorSize;
+#if VK_HEADER_VERSION >= 135
+		case vk::DescriptorType::eAccelerationStructureKHR:	return aProperties.accelerationStructureDescriptorSize;
+#endif
+		default:
+			throw avk::logic_error("Descriptors of type " + vk::to_string(aType) + " are not supported by the descriptor_buffer backend.");
+		}
+	}
+
+	void descriptor_cache_t::write_descriptor_into_descriptor_buffer(const vk::WriteDescriptorSet& aWrite, uint32_t aElement, void* aDst, size_t aDescriptorSize) const
+	{
+		auto getInfo = vk::DescriptorGetInfoEXT{}.setType(aWrite.descriptorType);
+		vk::DescriptorAddressInfoEXT addressInfo;
+		switch (aWrite.descriptorType) {
+		case vk::DescriptorType::eSampler:
+			getInfo.data.pSampler = &aWrite.pImageInfo[aElement].sampler;
+			break;
+		case vk::DescriptorType::eCombinedImageSampler:
+			getInfo.data.pCombinedImageSampler = &aWrite.pImageInfo[aElement];
+			break;
+		case vk::DescriptorType::eSampledImage:
+			getInfo.data.pSampledImage = &aWrite.pImageInfo[aElement];
+			break;
+		case vk::DescriptorType::eStorageImage:
+			getInfo.data.pStorageImage = &aWrite.pImageInfo[aElement];
+			break;
+		case vk::DescriptorType::eInputAttachment:
+			getInfo.data.pInputAttachmentImage = &aWrite.pImageInfo[aElement];
+			break;
+		case vk::DescriptorType::eUniformBuffer:
+		case vk::DescriptorType::eStorageBuffer:
+		{
+			// The buffers must have been created with vk::BufferUsageFlagBits::eShaderDeviceAddress:
+			const auto& bufferInfo = aWrite.pBufferInfo[aElement];
+			addressInfo = vk::DescriptorAddressInfoEXT{}
+				.setAddress(root::get_buffer_address(mRoot->device(), bufferInfo.buffer) + bufferInfo.offset)
+				.setRange(bufferInfo.range);
+			if (vk::DescriptorType::eUniformBuffer == aWrite.descriptorType) {
+				getInfo.data.pUniformBuffer = &addressInfo;
+			}
+			else {
+				getInfo.data.pStorageBuffer = &addressInfo;
+			}
+			break;
+		}
+#if VK_HEADER_VERSION >= 135
+		case vk::DescriptorType::eAccelerationStructureKHR:
+		{
+			const auto* asWrite = reinterpret_cast<const vk::WriteDescriptorSetAccelerationStructureKHR*>(aWrite.pNext);
+			getInfo.data.accelerationStructure = mRoot->device().getAccelerationStructureAddressKHR(vk::AccelerationStructureDeviceAddressInfoKHR{ asWrite->pAccelerationStructures[aElement] }, mRoot->dispatch_loader_ext());
+			break;
+		}
+#endif
+		default:
+			// Texel buffers would require the buffer views' underlying buffers and formats; dynamic buffers are not supported by descriptor buffers at all.
+			throw avk::logic_error("Descriptors of type " + vk::to_string(aWrite.descriptorType) + " are not supported by the descriptor_buffer backend.");
+		}
+		mRoot->device().getDescriptorEXT(getInfo, aDescriptorSize, aDst, mRoot->dispatch_loader_ext());
+	}
+#endif
+
 	void descriptor_cache_t::cleanup()
 	{
-		mSets.clear();
-		mLayouts.clear();
+		for (auto& shard : mState->mSetShards) {
+			std::unique_lock lock(shard.mMutex);
+			for (auto& index : shard.mSetsByHandle) {
+				index.clear();
+			}
+			shard.mSets.clear();
+		}
+		{
+			std::scoped_lock lock{ mState->mRetiredSetsMutex };
+			mState->mRetiredSets.clear();
+		}
+		std::unique_lock lock(mState->mLayoutsMutex);
+		mState->mLayouts.clear();
+	}
+
+	std::tuple<std::shared_lock<std::shared_mutex>, descriptor_cache_t::thread_pools&> descriptor_cache_t::lock_pools_of_this_thread()
+	{
+		const auto tId = std::this_thread::get_id();
+		for (;;) {
+			{
+				std::shared_lock lock(mState->mDescriptorPoolsMutex);
+				const auto it = mState->mDescriptorPools.find(tId);
+				if (mState->mDescriptorPools.end() != it) {
+					return { std::move(lock), *it->second }; // Stays at the same place, even if other threads insert their lists
+				}
+			}
+			std::unique_lock lock(mState->mDescriptorPoolsMutex);
+			auto& pools = mState->mDescriptorPools[tId];
+			if (!pools) {
+				pools = std::make_unique<thread_pools>();
+			}
+			// Take the shared lock again; begin_frame() might have removed the (empty) list in the meantime, though.
+		}
 	}
 
 	std::shared_ptr<descriptor_pool> descriptor_cache_t::get_descriptor_pool_for_layouts(const descriptor_alloc_request& aAllocRequest, bool aRequestNewPool)
 	{
-		// We'll allocate the pools per (thread and name)
-		auto tId = std::this_thread::get_id();
-		auto& pools = mDescriptorPools[tId];
+		auto [poolsLock, pools] = lock_pools_of_this_thread();
+		return get_descriptor_pool_for_layouts(pools, aAllocRequest, aRequestNewPool);
+	}
 
-		// First of all, do some cleanup => remove all pools which no longer exist:
-		pools.erase(std::remove_if(std::begin(pools), std::end(pools), [](const std::weak_ptr<descriptor_pool>& ptr) {
-			return ptr.expired();
-		}), std::end(pools));
+	std::shared_ptr<descriptor_pool> descriptor_cache_t::get_descriptor_pool_for_layouts(thread_pools& aPools, const descriptor_alloc_request& aAllocRequest, bool aRequestNewPool)
+	{
+		// We'll allocate the pools per (thread and name). Only this thread accesses its pools, while holding a shared lock
+		// of mDescriptorPoolsMutex. Empty pools are reset (or destroyed) by begin_frame(), under an exclusive lock.
+		auto tId = std::this_thread::get_id();
+		auto& pools = aPools;
 
 		// Find a pool which is capable of allocating this:
 		if (!aRequestNewPool) {
-			for (auto& pool : pools) {
-				if (auto sptr = pool.lock()) {
-					if (sptr->has_capacity_for(aAllocRequest)) {
-						return sptr;
-					}
+			for (auto& entry : pools) {
+				if (entry.mPool->has_capacity_for(aAllocRequest)) {
+					return entry.mPool;
 				}
 			}
 		}
@@ -3569,7 +4511,8 @@ namespace avk
 			  : amplifiedAllocRequest.accumulated_pool_sizes(),
 			isNvidia
 			  ? aAllocRequest.num_sets() * prealloc_factor()
-			  : aAllocRequest.num_sets() * prealloc_factor() * 2 // the last factor is a "magic number"/"educated guess"/"preemtive strike"
+			  : aAllocRequest.num_sets() * prealloc_factor() * 2, // the last factor is a "magic number"/"educated guess"/"preemtive strike"
+			vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet // Evicted and removed sets are freed individually, see free_retired_sets_and_sweep_pools
 		);
 
 		auto newPoolPtr = std::make_shared<descriptor_pool>(std::move(newPool));
@@ -3579,7 +4522,7 @@ namespace avk
 		//if (!isNvidia) {
 		//}
 
-		pools.emplace_back(newPoolPtr); // Store as a weak_ptr
+		pools.push_back(pool_entry{ newPoolPtr, amplifiedAllocRequest.accumulated_pool_sizes() });
 		return newPoolPtr;
 	}
 #pragma endregion
@@ -3588,6 +4531,10 @@ namespace avk
 
 	bool operator ==(const descriptor_set& left, const descriptor_set& right)
 	{
+		// Different contents have different hashes; only if the hashes match, the contents have to be compared:
+		if (left.mHash != right.mHash) {
+			return false;
+		}
 		const auto n = left.mOrderedDescriptorDataWrites.size();
 		if (n != right.mOrderedDescriptorDataWrites.size()) {
 			return false;
@@ -3638,6 +4585,174 @@ namespace avk
 		return !(left == right);
 	}
 
+	std::size_t descriptor_set::compute_hash() const
+	{
+		const auto handleValue = [](auto aHandle) -> uint64_t {
+			return reinterpret_cast<uint64_t>(static_cast<typename decltype(aHandle)::CType>(aHandle));
+		};
+
+		uint64_t h = 0;
+		for (const auto& w : mOrderedDescriptorDataWrites) {
+			h = hash_mix(h, (static_cast<uint64_t>(w.dstBinding) << 32) | w.dstArrayElement);
+			h = hash_mix(h, (static_cast<uint64_t>(w.descriptorCount) << 32) | static_cast<uint32_t>(w.descriptorType));
+			for (uint32_t i = 0; i < w.descriptorCount; ++i) {
+				if (nullptr != w.pImageInfo) {
+					h = hash_mix(h, handleValue(w.pImageInfo[i].sampler));
+					h = hash_mix(h, handleValue(w.pImageInfo[i].imageView));
+					h = hash_mix(h, static_cast<uint64_t>(w.pImageInfo[i].imageLayout));
+				}
+				if (nullptr != w.pBufferInfo) {
+					h = hash_mix(h, handleValue(w.pBufferInfo[i].buffer));
+					h = hash_mix(h, w.pBufferInfo[i].offset);
+					h = hash_mix(h, w.pBufferInfo[i].range);
+				}
+				if (nullptr != w.pTexelBufferView) {
+					h = hash_mix(h, handleValue(w.pTexelBufferView[i]));
+				}
+			}
+
+#if VK_HEADER_VERSION >= 135
+			if (nullptr != w.pNext && w.descriptorType == vk::DescriptorType::eAccelerationStructureKHR) {
+				const auto* asInfo = reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(w.pNext);
+				h = hash_mix(h, asInfo->accelerationStructureCount);
+				for (uint32_t i = 0; i < asInfo->accelerationStructureCount; ++i) {
+					h = hash_mix(h, reinterpret_cast<uint64_t>(asInfo->pAccelerationStructures[i]));
+				}
+			}
+#endif
+		}
+		return static_cast<std::size_t>(h);
+	}
+
+	template <typename F>
+	void descriptor_set::for_each_descriptor_of(const binding_data& aBinding, F aFunc)
+	{
+		// Yields the same data which binding_data stores into a prepared set, but without storing it:
+		const auto forOne = [&aFunc](const auto* aResource) {
+			using T = std::remove_cv_t<std::remove_pointer_t<std::decay_t<decltype(aResource)>>>;
+			if constexpr (std::is_same_v<T, buffer_view_t> || std::is_same_v<T, buffer_view_descriptor_info>) {
+				aFunc(aResource->view_handle());
+			}
+			else if constexpr (std::is_same_v<T, top_level_acceleration_structure_t>) {
+#if VK_HEADER_VERSION >= 135
+				const auto& info = aResource->descriptor_info();
+				for (uint32_t i = 0u; i < info.accelerationStructureCount; ++i) {
+					aFunc(info.pAccelerationStructures[i]);
+				}
+#endif
+			}
+			else {
+				aFunc(aResource->descriptor_info());
+			}
+		};
+		std::visit([&forOne](const auto& aResource) {
+			using R = std::decay_t<decltype(aResource)>;
+			if constexpr (std::is_pointer_v<R>) {
+				forOne(aResource);
+			}
+			else if constexpr (!std::is_same_v<R, std::monostate>) {
+				for (const auto* r : aResource) {
+					forOne(r);
+				}
+			}
+		}, aBinding.mResourcePtr);
+	}
+
+	std::size_t descriptor_set::hash_of(const binding_data* aBegin, const binding_data* aEnd)
+	{
+		const auto handleValue = [](auto aHandle) -> uint64_t {
+			return reinterpret_cast<uint64_t>(static_cast<typename decltype(aHandle)::CType>(aHandle));
+		};
+
+		// Mixes exactly the values which compute_hash() mixes for the set that prepare() would create from these bindings:
+		uint64_t h = 0;
+		for (const auto* b = aBegin; b != aEnd; ++b) {
+			h = hash_mix(h, static_cast<uint64_t>(b->mLayoutBinding.binding) << 32); // dstArrayElement is always 0
+			h = hash_mix(h, (static_cast<uint64_t>(b->descriptor_count()) << 32) | static_cast<uint32_t>(b->mLayoutBinding.descriptorType));
+			uint32_t numAccelerationStructures = 0u;
+			for_each_descriptor_of(*b, [&](const auto& aDescriptor) {
+				using D = std::decay_t<decltype(aDescriptor)>;
+				if constexpr (std::is_same_v<D, vk::DescriptorImageInfo>) {
+					h = hash_mix(h, handleValue(aDescriptor.sampler));
+					h = hash_mix(h, handleValue(aDescriptor.imageView));
+					h = hash_mix(h, static_cast<uint64_t>(aDescriptor.imageLayout));
+				}
+				else if constexpr (std::is_same_v<D, vk::DescriptorBufferInfo>) {
+					h = hash_mix(h, handleValue(aDescriptor.buffer));
+					h = hash_mix(h, aDescriptor.offset);
+					h = hash_mix(h, aDescriptor.range);
+				}
+				else if constexpr (std::is_same_v<D, vk::BufferView>) {
+					h = hash_mix(h, handleValue(aDescriptor));
+				}
+				else {
+					++numAccelerationStructures;
+				}
+			});
+
+#if VK_HEADER_VERSION >= 135
+			const bool holdsAccelerationStructures = std::holds_alternative<const top_level_acceleration_structure_t*>(b->mResourcePtr)
+				|| std::holds_alternative<std::vector<const top_level_acceleration_structure_t*>>(b->mResourcePtr);
+			if (holdsAccelerationStructures && b->mLayoutBinding.descriptorType == vk::DescriptorType::eAccelerationStructureKHR) {
+				h = hash_mix(h, numAccelerationStructures);
+				for_each_descriptor_of(*b, [&](const auto& aDescriptor) {
+					if constexpr (std::is_same_v<std::decay_t<decltype(aDescriptor)>, vk::AccelerationStructureKHR>) {
+						h = hash_mix(h, handleValue(aDescriptor));
+					}
+				});
+			}
+#endif
+		}
+		return static_cast<std::size_t>(h);
+	}
+
+	bool descriptor_set::has_contents_of(const binding_data* aBegin, const binding_data* aEnd) const
+	{
+		if (static_cast<size_t>(aEnd - aBegin) != mOrderedDescriptorDataWrites.size()) {
+			return false;
+		}
+		for (size_t i = 0; i < mOrderedDescriptorDataWrites.size(); ++i) {
+			const auto& w = mOrderedDescriptorDataWrites[i];
+			const auto& b = aBegin[i];
+			if (w.dstBinding != b.mLayoutBinding.binding || 0u != w.dstArrayElement || w.descriptorType != b.mLayoutBinding.descriptorType || w.descriptorCount != b.descriptor_count()) {
+				return false;
+			}
+
+			bool equal = true;
+			uint32_t element = 0u;
+			uint32_t accelerationStructure = 0u;
+			for_each_descriptor_of(b, [&](const auto& aDescriptor) {
+				using D = std::decay_t<decltype(aDescriptor)>;
+				if constexpr (std::is_same_v<D, vk::DescriptorImageInfo>) {
+					equal = equal && nullptr != w.pImageInfo && element < w.descriptorCount && w.pImageInfo[element++] == aDescriptor;
+				}
+				else if constexpr (std::is_same_v<D, vk::DescriptorBufferInfo>) {
+					equal = equal && nullptr != w.pBufferInfo && element < w.descriptorCount && w.pBufferInfo[element++] == aDescriptor;
+				}
+				else if constexpr (std::is_same_v<D, vk::BufferView>) {
+					equal = equal && nullptr != w.pTexelBufferView && element < w.descriptorCount && w.pTexelBufferView[element++] == aDescriptor;
+				}
+				else {
+#if VK_HEADER_VERSION >= 135
+					const auto* asInfo = reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(w.pNext);
+					equal = equal && nullptr != asInfo && accelerationStructure < asInfo->accelerationStructureCount
+						&& asInfo->pAccelerationStructures[accelerationStructure++] == static_cast<VkAccelerationStructureKHR>(aDescriptor);
+#endif
+				}
+			});
+			if (!equal) {
+				return false;
+			}
+#if VK_HEADER_VERSION >= 135
+			if (nullptr != w.pNext && w.descriptorType == vk::DescriptorType::eAccelerationStructureKHR
+				&& reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(w.pNext)->accelerationStructureCount != accelerationStructure) {
+				return false;
+			}
+#endif
+		}
+		return true;
+	}
+
 	void descriptor_set::update_data_pointers()
 	{
 		for (auto& w : mOrderedDescriptorDataWrites) {
@@ -3686,6 +4801,18 @@ namespace avk
 		}
 	}
 
+	descriptor_set descriptor_set::prepare(std::vector<binding_data> aBindings)
+	{
+		if (aBindings.empty()) {
+			throw avk::logic_error("Cannot prepare a descriptor set without any bindings.");
+		}
+		std::sort(std::begin(aBindings), std::end(aBindings)); // use operator<
+		if (aBindings.front().mSetId != aBindings.back().mSetId) {
+			throw avk::logic_error("All the bindings of a descriptor set must refer to the same set-id, but set-ids " + std::to_string(aBindings.front().mSetId) + " to " + std::to_string(aBindings.back().mSetId) + " have been passed.");
+		}
+		return prepare(std::begin(aBindings), std::end(aBindings));
+	}
+
 	void descriptor_set::link_to_handle_and_pool(vk::DescriptorSet aHandle, std::shared_ptr<descriptor_pool> aPool)
 	{
 		mDescriptorSet = aHandle;
@@ -3695,6 +4822,30 @@ namespace avk
 		mPool = std::move(aPool);
 	}
 
+	void descriptor_set::free_from_pool()
+	{
+		assert(mPool && mDescriptorSet);
+		std::vector<vk::DescriptorPoolSize> sizes;
+		for (const auto& w : mOrderedDescriptorDataWrites) {
+			auto it = std::find_if(std::begin(sizes), std::end(sizes), [&w](const vk::DescriptorPoolSize& el) { return el.type == w.descriptorType; });
+			if (std::end(sizes) == it) {
+				sizes.emplace_back(w.descriptorType, w.descriptorCount);
+			}
+			else {
+				it->descriptorCount += w.descriptorCount;
+			}
+		}
+		mPool->free(avk::make_vector(mDescriptorSet), sizes);
+		mPool.reset();
+		mDescriptorSet = vk::DescriptorSet{};
+	}
+
+	void descriptor_set::link_to_descriptor_buffer(vk::DeviceAddress aBufferAddress, vk::DeviceSize aOffset)
+	{
+		mDescriptorBufferAddress = aBufferAddress;
+		mDescriptorBufferOffset = aOffset;
+	}
+
 	void descriptor_set::write_descriptors()
 	{
 		assert(mDescriptorSet);
@@ -3702,205 +4853,212 @@ namespace avk
 		mPool.get()->mDescriptorPool.getOwner().updateDescriptorSets(static_cast<uint32_t>(mOrderedDescriptorDataWrites.size()), mOrderedDescriptorDataWrites.data(), 0u, nullptr);
 	}
 
+	void descriptor_set::write_descriptors(const descriptor_set_layout& aLayout)
+	{
+		if (!aLayout.has_update_template()) {
+			write_descriptors();
+			return;
+		}
+		assert(mDescriptorSet);
+
+		// Copy the stored descriptor data of each binding to the location where the template expects it:
+		std::vector<uint8_t> data(aLayout.update_template_data_size());
+		const auto& entries = aLayout.update_template_entries();
+		auto copyToEntry = [&entries, &data](uint32_t aBinding, const void* aSrc, size_t aCount) {
+			const auto it = std::lower_bound(std::begin(entries), std::end(entries), aBinding, [](const vk::DescriptorUpdateTemplateEntry& e, uint32_t b) { return e.dstBinding < b; });
+			assert(it != std::end(entries) && it->dstBinding == aBinding);
+			assert(aCount <= it->descriptorCount);
+			std::memcpy(data.data() + it->offset, aSrc, std::min<size_t>(aCount, it->descriptorCount) * it->stride);
+		};
+		for (const auto& [binding, infos] : mStoredImageInfos) {
+			copyToEntry(binding, infos.data(), infos.size());
+		}
+		for (const auto& [binding, infos] : mStoredBufferInfos) {
+			copyToEntry(binding, infos.data(), infos.size());
+		}
+		for (const auto& [binding, views] : mStoredBufferViews) {
+			copyToEntry(binding, views.data(), views.size());
+		}
+#if VK_HEADER_VERSION >= 135
+		for (const auto& [binding, asWrite] : mStoredAccelerationStructureWrites) {
+			const auto& handles = std::get<std::vector<vk::AccelerationStructureKHR>>(asWrite);
+			copyToEntry(binding, handles.data(), handles.size());
+		}
+#endif
+
+		mPool.get()->mDescriptorPool.getOwner().updateDescriptorSetWithTemplate(mDescriptorSet, aLayout.update_template_handle(), data.data());
+	}
+
 	std::vector<descriptor_set> descriptor_cache_t::get_or_create_descriptor_sets(std::initializer_list<binding_data> aBindings)
 	{
-		std::vector<binding_data> orderedBindings;
-		uint32_t minSetId = std::numeric_limits<uint32_t>::max();
-		uint32_t maxSetId = std::numeric_limits<uint32_t>::min();
+		if (0 == aBindings.size()) {
+			return {};
+		}
 
-		// Step 1: order the bindings
-		for (auto& b : aBindings) {
-			minSetId = std::min(minSetId, b.mSetId);
-			maxSetId = std::max(maxSetId, b.mSetId);
-			auto it = std::lower_bound(std::begin(orderedBindings), std::end(orderedBindings), b); // use operator<
-			orderedBindings.insert(it, b);
+		// Step 1: order the bindings. Usually, they are passed in order already => use them in place, without copying:
+		std::vector<binding_data> sortedCopy;
+		const binding_data* begin = aBindings.begin();
+		const binding_data* end = begin + aBindings.size();
+		if (!std::is_sorted(begin, end)) { // use operator<
+			sortedCopy.assign(begin, end);
+			std::sort(std::begin(sortedCopy), std::end(sortedCopy));
+			begin = sortedCopy.data();
+			end = begin + sortedCopy.size();
 		}
 
-		std::vector<std::reference_wrapper<const descriptor_set_layout>> layouts;
-		std::vector<descriptor_set> preparedSets;
-		std::vector<descriptor_set> cachedSets;
-		std::vector<bool>           validSets;
+		size_t numSets = 1;
+		for (auto* it = begin + 1; it != end; ++it) {
+			if (it->mSetId != (it - 1)->mSetId) {
+				++numSets;
+			}
+		}
 
-		// Step 2: go through all the sets, get or alloc layouts, and see if the descriptor sets are already in cache, by chance.
-		for (uint32_t setId = minSetId; setId <= maxSetId; ++setId) {
-			auto lb = std::lower_bound(std::begin(orderedBindings), std::end(orderedBindings), binding_data{ setId },
-				[](const binding_data& first, const binding_data& second) -> bool {
-					return first.mSetId < second.mSetId;
-				});
-			auto ub = std::upper_bound(std::begin(orderedBindings), std::end(orderedBindings), binding_data{ setId },
-				[](const binding_data& first, const binding_data& second) -> bool {
-					return first.mSetId < second.mSetId;
-				});
+		std::vector<descriptor_set> result;
+		result.reserve(numSets);
 
-			// Handle empty sets:
-			if (lb == ub) {
-				continue;
+		// Only needed if not everything is cached:
+		std::vector<std::reference_wrapper<const descriptor_set_layout>> layoutsForAlloc;
+		std::vector<descriptor_set> toBeAlloced;
+		std::vector<size_t> indexMapping;
+
+		// Step 2: go through all the sets, and see if they are already in cache. Layouts are only required for those which are not:
+		auto* lb = begin;
+		while (lb != end) {
+			auto* ub = lb + 1;
+			while (ub != end && ub->mSetId == lb->mSetId) {
+				++ub;
 			}
 
-			const auto& layout = get_or_alloc_layout(descriptor_set_layout::prepare(lb, ub));
-			layouts.emplace_back(layout);
-			auto preparedSet = descriptor_set::prepare(lb, ub);
-			auto cachedSet = get_descriptor_set_from_cache(preparedSet);
+			// Look up the set by its bindings; only if it is not in the cache, it has to be prepared:
+			auto cachedSet = find_in_cache(lb, ub);
 			if (cachedSet.has_value()) {
-				auto& back = cachedSets.emplace_back(std::move(cachedSet.value()));
-				validSets.push_back(true);
+				result.push_back(std::move(cachedSet.value()));
 			}
 			else {
-				cachedSets.emplace_back();
-				validSets.push_back(false);
+				layoutsForAlloc.emplace_back(get_or_alloc_layout(descriptor_set_layout::prepare(lb, ub)));
+				toBeAlloced.push_back(descriptor_set::prepare(lb, ub));
+				assert(toBeAlloced.back().hash() == descriptor_set::hash_of(lb, ub));
+				indexMapping.push_back(result.size());
+				result.emplace_back();
 			}
-			preparedSets.emplace_back(std::move(preparedSet));
+			lb = ub;
 		}
 
-		if (static_cast<int>(cachedSets.size()) == std::count(std::begin(validSets), std::end(validSets), true)) {
+		if (indexMapping.empty()) {
 			// Everything is cached; we're done.
-			return cachedSets;
+			return result;
 		}
 
 		// HOWEVER, if not...
-		std::vector<std::reference_wrapper<const descriptor_set_layout>> layoutsForAlloc;
-		std::vector<descriptor_set> toBeAlloced;
-		std::vector<size_t> indexMapping;
-		for (size_t i = 0; i < cachedSets.size(); ++i) {
-			if (!validSets[i]) {
-				layoutsForAlloc.push_back(layouts[i]);
-				toBeAlloced.push_back(std::move(preparedSets[i]));
-				indexMapping.push_back(i);
-			}
-		}
 		auto nowAlsoInCache = alloc_new_descriptor_sets(layoutsForAlloc, std::move(toBeAlloced));
 		for (size_t i = 0; i < indexMapping.size(); ++i) {
-			cachedSets[indexMapping[i]] = nowAlsoInCache[i];
+			result[indexMapping[i]] = std::move(nowAlsoInCache[i]);
 		}
-		return cachedSets;
+		return result;
 	}
 
-	int descriptor_cache_t::remove_sets_with_handle(vk::ImageView aHandle)
+	template <typename F>
+	void descriptor_cache_t::for_each_referenced_handle(const descriptor_set& aSet, F aFunc)
 	{
-		int numDeleted = 0;
-		auto it = std::begin(mSets);
-		do {
-			it = std::find_if(std::begin(mSets), std::end(mSets), [aHandle](const descriptor_set& aSet) {
-				auto n = aSet.number_of_writes();
-				for (decltype(n) i = 0; i < n; ++i) {
-					const auto& w = aSet.write_at(i);
-					auto dn = w.descriptorCount;
-					if (0u == dn || nullptr == w.pImageInfo) {
-						continue;
+		auto n = aSet.number_of_writes();
+		for (decltype(n) i = 0; i < n; ++i) {
+			const auto& w = aSet.write_at(i);
+			for (uint32_t di = 0; di < w.descriptorCount; ++di) {
+				if (nullptr != w.pImageInfo) {
+					if (w.pImageInfo[di].imageView) {
+						aFunc(handle_kind::image_view, handle_key(w.pImageInfo[di].imageView));
 					}
-					for (decltype(dn) di = 0; di < dn; ++di) {
-						if (w.pImageInfo[di].imageView == aHandle) {
-							return true;
-						}
+					if (w.pImageInfo[di].sampler) {
+						aFunc(handle_kind::sampler, handle_key(w.pImageInfo[di].sampler));
 					}
 				}
-				return false;
-			});
-
-			if (std::end(mSets) != it) {
-				mSets.erase(it);
-				++numDeleted;
-				// Iterator could (will) have been invalidated => reinitialize:
-				it = std::begin(mSets);
+				if (nullptr != w.pBufferInfo && w.pBufferInfo[di].buffer) {
+					aFunc(handle_kind::buffer, handle_key(w.pBufferInfo[di].buffer));
+				}
+				if (nullptr != w.pTexelBufferView && w.pTexelBufferView[di]) {
+					aFunc(handle_kind::buffer_view, handle_key(w.pTexelBufferView[di]));
+				}
 			}
-		} while (std::end(mSets) != it);
-		return numDeleted;
+		}
 	}
 
-	int descriptor_cache_t::remove_sets_with_handle(vk::Buffer aHandle)
+	void descriptor_cache_t::add_to_reverse_index(set_shard& aShard, const descriptor_set& aSet)
 	{
-		int numDeleted = 0;
-		auto it = std::begin(mSets);
-		do {
-			it = std::find_if(std::begin(mSets), std::end(mSets), [aHandle](const descriptor_set& aSet) {
-				auto n = aSet.number_of_writes();
-				for (decltype(n) i = 0; i < n; ++i) {
-					const auto& w = aSet.write_at(i);
-					auto dn = w.descriptorCount;
-					if (0u == dn || nullptr == w.pBufferInfo) {
-						continue;
-					}
-					for (decltype(dn) di = 0; di < dn; ++di) {
-						if (w.pBufferInfo[di].buffer == aHandle) {
-							return true;
-						}
-					}
-				}
-				return false;
-				});
+		for_each_referenced_handle(aSet, [&aShard, &aSet](handle_kind aKind, uint64_t aKey) {
+			auto& index = aShard.mSetsByHandle[static_cast<size_t>(aKind)];
+			// A set can refer to the same handle multiple times, but is only indexed once per handle:
+			const auto range = index.equal_range(aKey);
+			if (std::none_of(range.first, range.second, [&aSet](const auto& entry) { return entry.second == &aSet; })) {
+				index.emplace(aKey, &aSet);
+			}
+		});
+	}
 
-			if (std::end(mSets) != it) {
-				mSets.erase(it);
-				++numDeleted;
-				// Iterator could (will) have been invalidated => reinitialize:
-				it = std::begin(mSets);
+	descriptor_cache_t::set_map::iterator descriptor_cache_t::erase_from_shard(set_shard& aShard, set_map::iterator aIt)
+	{
+		const descriptor_set* setPtr = &aIt->first;
+		for_each_referenced_handle(aIt->first, [&aShard, setPtr](handle_kind aKind, uint64_t aKey) {
+			auto& index = aShard.mSetsByHandle[static_cast<size_t>(aKind)];
+			const auto range = index.equal_range(aKey);
+			const auto it = std::find_if(range.first, range.second, [setPtr](const auto& entry) { return entry.second == setPtr; });
+			if (range.second != it) {
+				index.erase(it);
 			}
-		} while (std::end(mSets) != it);
-		return numDeleted;
+		});
+
+		const auto next = std::next(aIt);
+		auto node = aShard.mSets.extract(aIt);
+		// Sets from pools are freed by begin_frame(), once no frame in flight can use them anymore:
+		if (mState->mTracksFrames.load(std::memory_order_relaxed) && nullptr != node.key().pool()) {
+			std::scoped_lock lock{ mState->mRetiredSetsMutex };
+			mState->mRetiredSets.push_back(retired_set{ std::move(node.key()), node.mapped().mLastUsedFrame.load(std::memory_order_relaxed) });
+		}
+		return next;
 	}
 
-	int descriptor_cache_t::remove_sets_with_handle(vk::Sampler aHandle)
+	int descriptor_cache_t::remove_sets_with_handle(handle_kind aKind, uint64_t aHandleKey)
 	{
 		int numDeleted = 0;
-		auto it = std::begin(mSets);
-		do {
-			it = std::find_if(std::begin(mSets), std::end(mSets), [aHandle](const descriptor_set& aSet) {
-				auto n = aSet.number_of_writes();
-				for (decltype(n) i = 0; i < n; ++i) {
-					const auto& w = aSet.write_at(i);
-					auto dn = w.descriptorCount;
-					if (0u == dn || nullptr == w.pImageInfo) {
-						continue;
-					}
-					for (decltype(dn) di = 0; di < dn; ++di) {
-						if (w.pImageInfo[di].sampler == aHandle) {
-							return true;
-						}
-					}
-				}
-				return false;
-				});
-
-			if (std::end(mSets) != it) {
-				mSets.erase(it);
+		for (auto& shard : mState->mSetShards) {
+			std::unique_lock lock(shard.mMutex);
+			auto& index = shard.mSetsByHandle[static_cast<size_t>(aKind)];
+			const auto range = index.equal_range(aHandleKey);
+			if (range.first == range.second) {
+				continue;
+			}
+			// Collect first, because erasing the sets also erases their entries from the index:
+			std::vector<const descriptor_set*> affectedSets;
+			for (auto it = range.first; it != range.second; ++it) {
+				affectedSets.push_back(it->second);
+			}
+			for (const auto* setPtr : affectedSets) {
+				const auto it = shard.mSets.find(*setPtr);
+				assert(shard.mSets.end() != it);
+				erase_from_shard(shard, it);
 				++numDeleted;
-				// Iterator could (will) have been invalidated => reinitialize:
-				it = std::begin(mSets);
 			}
-		} while (std::end(mSets) != it);
+		}
 		return numDeleted;
 	}
 
-	int descriptor_cache_t::remove_sets_with_handle(vk::BufferView aHandle)
+	int descriptor_cache_t::remove_sets_with_handle(vk::ImageView aHandle)
 	{
-		int numDeleted = 0;
-		auto it = std::begin(mSets);
-		do {
-			it = std::find_if(std::begin(mSets), std::end(mSets), [aHandle](const descriptor_set& aSet) {
-				auto n = aSet.number_of_writes();
-				for (decltype(n) i = 0; i < n; ++i) {
-					const auto& w = aSet.write_at(i);
-					auto dn = w.descriptorCount;
-					if (0u == dn || nullptr == w.pTexelBufferView) {
-						continue;
-					}
-					for (decltype(dn) di = 0; di < dn; ++di) {
-						if (w.pTexelBufferView[di] == aHandle) {
-							return true;
-						}
-					}
-				}
-				return false;
-				});
+		return remove_sets_with_handle(handle_kind::image_view, handle_key(aHandle));
+	}
 
-			if (std::end(mSets) != it) {
-				mSets.erase(it);
-				++numDeleted;
-				// Iterator could (will) have been invalidated => reinitialize:
-				it = std::begin(mSets);
-			}
-		} while (std::end(mSets) != it);
-		return numDeleted;
+	int descriptor_cache_t::remove_sets_with_handle(vk::Buffer aHandle)
+	{
+		return remove_sets_with_handle(handle_kind::buffer, handle_key(aHandle));
+	}
+
+	int descriptor_cache_t::remove_sets_with_handle(vk::Sampler aHandle)
+	{
+		return remove_sets_with_handle(handle_kind::sampler, handle_key(aHandle));
+	}
+
+	int descriptor_cache_t::remove_sets_with_handle(vk::BufferView aHandle)
+	{
+		return remove_sets_with_handle(handle_kind::buffer_view, handle_key(aHandle));
 	}
 
 #pragma endregion
@@ -3931,6 +5089,16 @@ namespace avk
 		assert(static_cast<VkResult>(result) >= 0);
 	}
 
+	bool fence_t::is_signalled() const
+	{
+		return vk::Result::eSuccess == mFence.getOwner().getFenceStatus(handle());
+	}
+
+	int fence_t::export_sync_fd(const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader) const
+	{
+		return mFence.getOwner().getFenceFdKHR(vk::FenceGetFdInfoKHR{ handle(), vk::ExternalFenceHandleTypeFlagBits::eSyncFd }, aDispatchLoader);
+	}
+
 	void fence_t::reset()
 	{
 		// ReSharper disable once CppExpressionWithoutSideEffects
@@ -3964,6 +5132,32 @@ namespace avk
 	{
 		return create_fence(device(), dispatch_loader_core(), aCreateInSignalledState, std::move(aAlterConfigBeforeCreation));
 	}
+
+	fence root::create_fence_for_export(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, vk::ExternalFenceHandleTypeFlags aHandleTypes, bool aCreateInSignalledState, std::function<void(fence_t&)> aAlterConfigBeforeCreation)
+	{
+		fence_t result;
+		result.mExportCreateInfo = vk::ExportFenceCreateInfo{ aHandleTypes };
+		result.mCreateInfo = vk::FenceCreateInfo()
+			.setFlags(aCreateInSignalledState
+						? vk::FenceCreateFlagBits::eSignaled
+						: vk::FenceCreateFlags()
+			);
+
+		// Maybe alter the config?
+		if (aAlterConfigBeforeCreation) {
+			aAlterConfigBeforeCreation(result);
+		}
+
+		// Chain the export info in here, because result might have been moved in the meantime:
+		result.mCreateInfo.setPNext(&result.mExportCreateInfo);
+		result.mFence = aDevice.createFenceUnique(result.mCreateInfo, nullptr, aDispatchLoader);
+		return result;
+	}
+
+	fence root::create_fence_for_export(vk::ExternalFenceHandleTypeFlags aHandleTypes, bool aCreateInSignalledState, std::function<void(fence_t&)> aAlterConfigBeforeCreation)
+	{
+		return create_fence_for_export(device(), dispatch_loader_core(), aHandleTypes, aCreateInSignalledState, std::move(aAlterConfigBeforeCreation));
+	}
 #pragma endregion
 
 #pragma region framebuffer definitions
@@ -4242,7 +5436,9 @@ namespace avk
 	// Set sensible defaults:
 	graphics_pipeline_config::graphics_pipeline_config()
 		: mPipelineSettings{ cfg::pipeline_settings::nothing }
+		, mDynamicState{ cfg::dynamic_state::nothing } // everything baked into the pipeline
 		, mRenderPassSubpass {} // not set by default
+		, mDynamicRendering {} // not set by default
 		, mPrimitiveTopology{ cfg::primitive_topology::triangles } // triangles after one another
 		, mRasterizerGeometryMode{ cfg::rasterizer_geometry_mode::rasterize_geometry } // don't discard, but rasterize!
 		, mPolygonDrawingModeAndConfig{ cfg::polygon_drawing::config_for_filling() } // Fill triangles
@@ -4259,6 +5455,33 @@ namespace avk
 
 	namespace cfg
 	{
+		dynamic_rendering dynamic_rendering::for_formats(std::vector<vk::Format> aColorFormats, vk::Format aDepthStencilFormat, vk::SampleCountFlagBits aSampleCount)
+		{
+			return dynamic_rendering{
+				std::move(aColorFormats),
+				is_depth_format(aDepthStencilFormat) ? aDepthStencilFormat : vk::Format::eUndefined,
+				has_stencil_component(aDepthStencilFormat) ? aDepthStencilFormat : vk::Format::eUndefined,
+				aSampleCount
+			};
+		}
+
+		dynamic_rendering dynamic_rendering::for_attachments(const std::vector<rendering_attachment>& aColorAttachments, const std::optional<rendering_attachment>& aDepthStencilAttachment)
+		{
+			std::vector<vk::Format> colorFormats;
+			colorFormats.reserve(aColorAttachments.size());
+			for (const auto& a : aColorAttachments) {
+				colorFormats.push_back(a.format());
+			}
+			const auto sampleCount = aColorAttachments.empty()
+				? (aDepthStencilAttachment.has_value() ? aDepthStencilAttachment->sample_count() : vk::SampleCountFlagBits::e1)
+				: aColorAttachments.front().sample_count();
+			return for_formats(
+				std::move(colorFormats),
+				aDepthStencilAttachment.has_value() ? aDepthStencilAttachment->format() : vk::Format::eUndefined,
+				sampleCount
+			);
+		}
+
 		viewport_depth_scissors_config viewport_depth_scissors_config::from_framebuffer(const framebuffer_t& aFramebuffer)
 		{
 			const auto width = aFramebuffer.create_info().width;
@@ -4309,9 +5532,19 @@ namespace avk
 			.setPAttachments(aPreparedPipeline.mBlendingConfigsForColorAttachments.data());
 
 		aPreparedPipeline.mMultisampleStateCreateInfo
-			.setRasterizationSamples(aPreparedPipeline.renderpass_reference().num_samples_for_subpass(aPreparedPipeline.subpass_id()))
+			.setRasterizationSamples(aPreparedPipeline.is_for_dynamic_rendering()
+				? aPreparedPipeline.mDynamicRendering->mSampleCount
+				: aPreparedPipeline.renderpass_reference().num_samples_for_subpass(aPreparedPipeline.subpass_id()))
 			.setPSampleMask(nullptr);
 
+		if (aPreparedPipeline.is_for_dynamic_rendering()) {
+			aPreparedPipeline.mRenderingCreateInfo
+				.setColorAttachmentCount(static_cast<uint32_t>(aPreparedPipeline.mDynamicRendering->mColorAttachmentFormats.size()))
+				.setPColorAttachmentFormats(aPreparedPipeline.mDynamicRendering->mColorAttachmentFormats.data())
+				.setDepthAttachmentFormat(aPreparedPipeline.mDynamicRendering->mDepthAttachmentFormat)
+				.setStencilAttachmentFormat(aPreparedPipeline.mDynamicRendering->mStencilAttachmentFormat);
+		}
+
 		aPreparedPipeline.mDynamicStateCreateInfo
 			.setDynamicStateCount(static_cast<uint32_t>(aPreparedPipeline.mDynamicStateEntries.size()))
 			.setPDynamicStates(aPreparedPipeline.mDynamicStateEntries.data());
@@ -4324,9 +5557,10 @@ namespace avk
 
 		// Create the PIPELINE, a.k.a. putting it all together:
 		auto pipelineInfo = vk::GraphicsPipelineCreateInfo{}
-			// 0. Render Pass
-			.setRenderPass((*aPreparedPipeline.mRenderPass).handle())
-			.setSubpass(aPreparedPipeline.mSubpassIndex)
+			// 0. Render Pass (or attachment formats for dynamic rendering)
+			.setPNext(aPreparedPipeline.is_for_dynamic_rendering() ? &aPreparedPipeline.mRenderingCreateInfo : nullptr)
+			.setRenderPass(aPreparedPipeline.is_for_dynamic_rendering() ? vk::RenderPass{} : (*aPreparedPipeline.mRenderPass).handle())
+			.setSubpass(aPreparedPipeline.is_for_dynamic_rendering() ? 0u : aPreparedPipeline.mSubpassIndex)
 			// 1., 2., and 3.
 			.setPVertexInputState(&aPreparedPipeline.mPipelineVertexInputStateCreateInfo)
 			// 4.
@@ -4407,8 +5641,12 @@ namespace avk
 
 		graphics_pipeline_t result;
 
-		// 0. Own the renderpass
-		{
+		// 0. Own the renderpass, or store the attachment formats for dynamic rendering
+		if (aConfig.mDynamicRendering.has_value()) {
+			result.mDynamicRendering = std::move(aConfig.mDynamicRendering);
+			result.mSubpassIndex = 0u;
+		}
+		else {
 			assert(aConfig.mRenderPassSubpass.has_value());
 			auto [rp, sp] = std::move(aConfig.mRenderPassSubpass.value());
 			result.mRenderPass = std::move(rp);
@@ -4596,7 +5834,7 @@ namespace avk
 			}
 
 			// Iterate over all color target attachments and set a color blending config
-			if (result.subpass_id() >= result.mRenderPass->attachment_descriptions().size()) {
+			if (!result.is_for_dynamic_rendering() && result.subpass_id() >= result.mRenderPass->attachment_descriptions().size()) {
 				throw avk::runtime_error(
 					"There are fewer subpasses in the renderpass ("
 					+ std::to_string(result.mRenderPass->attachment_descriptions().size()) +
@@ -4604,7 +5842,9 @@ namespace avk
 					+ std::to_string(result.subpass_id()) +
 					") indicates. I.e. the subpass index is out of bounds.");
 			}
-			const auto n = result.mRenderPass->color_attachments_for_subpass(result.subpass_id()).size(); /////////////////// TODO: (doublecheck or) FIX this section (after renderpass refactoring)
+			const auto n = result.is_for_dynamic_rendering()
+				? result.mDynamicRendering->mColorAttachmentFormats.size()
+				: result.mRenderPass->color_attachments_for_subpass(result.subpass_id()).size(); /////////////////// TODO: (doublecheck or) FIX this section (after renderpass refactoring)
 			result.mBlendingConfigsForColorAttachments.reserve(n); // Important! Otherwise the vector might realloc and .data() will become invalid!
 			for (size_t i = 0; i < n; ++i) {
 				// Do we have a specific blending config for color attachment i?
@@ -4653,7 +5893,9 @@ namespace avk
 		// 10. Multisample state
 		// TODO: Can the settings be inferred from the renderpass' color attachments (as they are right now)? If they can't, how to handle this situation?
 		{ /////////////////// TODO: FIX this section (after renderpass refactoring)
-			vk::SampleCountFlagBits numSamples = (*result.mRenderPass).num_samples_for_subpass(result.subpass_id());
+			vk::SampleCountFlagBits numSamples = result.is_for_dynamic_rendering()
+				? result.mDynamicRendering->mSampleCount
+				: (*result.mRenderPass).num_samples_for_subpass(result.subpass_id());
 			
 			// Evaluate and set the PER SAMPLE shading configuration:
 			auto perSample = aConfig.mPerSampleShading.value_or(per_sample_shading_config{ false, 1.0f });
@@ -4702,6 +5944,58 @@ namespace avk
 				result.mDynamicStateEntries.push_back(vk::DynamicState::eStencilReference);
 				result.mDynamicStateEntries.push_back(vk::DynamicState::eStencilWriteMask);
 			}
+			// Check for extended dynamic state
+			auto isDynamic = [&aConfig](dynamic_state aWhich) { return (aConfig.mDynamicState & aWhich) == aWhich; };
+			if (isDynamic(dynamic_state::culling_mode)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eCullModeEXT);
+			}
+			if (isDynamic(dynamic_state::front_face)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eFrontFaceEXT);
+			}
+			if (isDynamic(dynamic_state::primitive_topology)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::ePrimitiveTopologyEXT);
+			}
+			if (isDynamic(dynamic_state::depth_test)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eDepthTestEnableEXT);
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eDepthCompareOpEXT);
+			}
+			if (isDynamic(dynamic_state::depth_write)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eDepthWriteEnableEXT);
+			}
+			if (isDynamic(dynamic_state::depth_bounds_test)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eDepthBoundsTestEnableEXT);
+			}
+			if (isDynamic(dynamic_state::stencil_test)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eStencilTestEnableEXT);
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eStencilOpEXT);
+			}
+			if (isDynamic(dynamic_state::rasterizer_geometry_mode)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eRasterizerDiscardEnableEXT);
+			}
+			if (isDynamic(dynamic_state::depth_bias)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eDepthBiasEnableEXT);
+			}
+			if (isDynamic(dynamic_state::primitive_restart)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::ePrimitiveRestartEnableEXT);
+			}
+#if VK_HEADER_VERSION >= 233
+			if (isDynamic(dynamic_state::polygon_drawing_mode)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::ePolygonModeEXT);
+			}
+			if (isDynamic(dynamic_state::depth_clamp)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eDepthClampEnableEXT);
+			}
+			if (isDynamic(dynamic_state::color_blending_enabled)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eColorBlendEnableEXT);
+			}
+			if (isDynamic(dynamic_state::color_write_mask)) {
+				result.mDynamicStateEntries.push_back(vk::DynamicState::eColorWriteMaskEXT);
+			}
+#else
+			if (isDynamic(dynamic_state::polygon_drawing_mode) || isDynamic(dynamic_state::depth_clamp) || isDynamic(dynamic_state::color_blending_enabled) || isDynamic(dynamic_state::color_write_mask)) {
+				throw avk::runtime_error("Dynamic polygon drawing mode, depth clamp, color blending enabled, and color write mask states require VK_EXT_extended_dynamic_state3, which is not supported by this version of the Vulkan headers.");
+			}
+#endif
 			// TODO: Support further dynamic states
 
 			result.mDynamicStateCreateInfo = vk::PipelineDynamicStateCreateInfo{}
@@ -4715,6 +6009,11 @@ namespace avk
 		if ((aConfig.mPipelineSettings & pipeline_settings::disable_optimization) == pipeline_settings::disable_optimization) {
 			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDisableOptimization;
 		}
+#if VK_HEADER_VERSION >= 235
+		if (avk::descriptor_backend::descriptor_buffer == descriptor_backend_in_use()) {
+			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDescriptorBufferEXT;
+		}
+#endif
 
 		// 13. Patch Control Points for Tessellation
 		if (aConfig.mTessellationPatchControlPoints.has_value()) {
@@ -4724,7 +6023,7 @@ namespace avk
 
 		// 14. Compile the PIPELINE LAYOUT data and create-info
 		// Get the descriptor set layouts
-		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings));
+		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings), aConfig.mPushDescriptorSetId, aConfig.mDescriptorSetLayoutFlags);
 		allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts);
 
 		// Gather the push constant data
@@ -4751,7 +6050,7 @@ namespace avk
 			aAlterConfigBeforeCreation(result);
 		}
 
-		assert (aConfig.mRenderPassSubpass.has_value());
+		assert (aConfig.mRenderPassSubpass.has_value() || result.is_for_dynamic_rendering());
 		rewire_config_and_create_graphics_pipeline(result);
 		return result;
 	}
@@ -4761,6 +6060,14 @@ namespace avk
 		graphics_pipeline_t result;
 		result.mRenderPass = std::move(aNewRenderpass);
 		result.mSubpassIndex = aSubpassIndex.value_or(cfg::subpass_index{ aTemplate.mSubpassIndex }).mSubpassIndex;
+		if (!result.mRenderPass.has_value()) {
+			// Without a new renderpass, the pipeline can only be created for dynamic rendering like its template:
+			if (!aTemplate.is_for_dynamic_rendering()) {
+				throw avk::logic_error("A renderpass must be provided if the template pipeline has not been created for dynamic rendering.");
+			}
+			result.mDynamicRendering = aTemplate.mDynamicRendering;
+			result.mRenderingCreateInfo = aTemplate.mRenderingCreateInfo;
+		}
 
 		result.mOrderedVertexInputBindingDescriptions	= aTemplate.mOrderedVertexInputBindingDescriptions;
 		result.mVertexInputAttributeDescriptions		= aTemplate.mVertexInputAttributeDescriptions	   ;
@@ -4809,7 +6116,10 @@ namespace avk
 	graphics_pipeline root::create_graphics_pipeline_from_template(const graphics_pipeline_t& aTemplate, std::function<void(graphics_pipeline_t&)> aAlterConfigBeforeCreation)
 	{
 		renderpass renderpassForPipeline;
-		if (aTemplate.mRenderPass.is_shared_ownership_enabled()) {
+		if (aTemplate.is_for_dynamic_rendering()) {
+			// No renderpass required => leave it empty
+		}
+		else if (aTemplate.mRenderPass.is_shared_ownership_enabled()) {
 			renderpassForPipeline = aTemplate.mRenderPass;
 		}
 		else {
@@ -5631,6 +6941,11 @@ namespace avk
 		return avk::submission_data(mRoot, aCommandBuffer, *this);
 	}
 
+	avk::submission_batch queue::submit_batch() const
+	{
+		return avk::submission_batch(mRoot, *this);
+	}
+
 	bool queue::is_prepared() const
 	{
 		return nullptr != mRoot && static_cast<bool>(mRoot->physical_device());
@@ -5831,7 +7146,7 @@ namespace avk
 		assert(static_cast<bool>(aPreparedPipeline.layout_handle()));
 
 		auto pipelineCreateInfo = vk::RayTracingPipelineCreateInfoKHR{}
-			.setFlags(vk::PipelineCreateFlagBits{}) // TODO: Support flags
+			.setFlags(aPreparedPipeline.mPipelineCreateFlags)
 			.setStageCount(static_cast<uint32_t>(aPreparedPipeline.mShaderStageCreateInfos.size()))
 			.setPStages(aPreparedPipeline.mShaderStageCreateInfos.data())
 			.setGroupCount(static_cast<uint32_t>(aPreparedPipeline.mShaderGroupCreateInfos.size()))
@@ -5948,6 +7263,11 @@ namespace avk
 		if ((aConfig.mPipelineSettings & pipeline_settings::disable_optimization) == pipeline_settings::disable_optimization) {
 			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDisableOptimization;
 		}
+#if VK_HEADER_VERSION >= 235
+		if (avk::descriptor_backend::descriptor_buffer == descriptor_backend_in_use()) {
+			result.mPipelineCreateFlags |= vk::PipelineCreateFlagBits::eDescriptorBufferEXT;
+		}
+#endif
 
 		// Get the offsets. We'll really need them in step 10. but already in step 3., we are gathering the correct byte offsets:
 		{
@@ -6152,7 +7472,7 @@ namespace avk
 		result.mMaxRecursionDepth = aConfig.mMaxRecursionDepth.mMaxRecursionDepth;
 
 		// 5. Pipeline layout
-		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings));
+		result.mAllDescriptorSetLayouts = set_of_descriptor_set_layouts::prepare(std::move(aConfig.mResourceBindings), aConfig.mPushDescriptorSetId, aConfig.mDescriptorSetLayoutFlags);
 		allocate_set_of_descriptor_set_layouts(result.mAllDescriptorSetLayouts);
 
 		// Gather the push constant data
@@ -7065,6 +8385,8 @@ namespace avk
 #pragma region semaphore definitions
 	semaphore_t::semaphore_t()
 		: mCreateInfo{}
+		, mTypeCreateInfo{}
+		, mExportCreateInfo{}
 		, mSemaphore{}
 		, mCustomDeleter{}
 	{
@@ -7101,6 +8423,81 @@ namespace avk
 		return create_semaphore(device(), dispatch_loader_core(), std::move(aAlterConfigBeforeCreation));
 	}
 
+	semaphore root::create_timeline_semaphore(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, uint64_t aInitialValue, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation)
+	{
+		semaphore_t result;
+		result.mTypeCreateInfo = vk::SemaphoreTypeCreateInfo{}
+			.setSemaphoreType(vk::SemaphoreType::eTimeline)
+			.setInitialValue(aInitialValue);
+		result.mCreateInfo = vk::SemaphoreCreateInfo{};
+
+		// Maybe alter the config?
+		if (aAlterConfigBeforeCreation) {
+			aAlterConfigBeforeCreation(result);
+		}
+
+		// Chain the type info in here, because result might have been moved in the meantime:
+		result.mCreateInfo.setPNext(&result.mTypeCreateInfo);
+		result.mSemaphore = aDevice.createSemaphoreUnique(result.mCreateInfo, nullptr, aDispatchLoader);
+		return result;
+	}
+
+	semaphore root::create_timeline_semaphore(uint64_t aInitialValue, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation)
+	{
+		return create_timeline_semaphore(device(), dispatch_loader_core(), aInitialValue, std::move(aAlterConfigBeforeCreation));
+	}
+
+	semaphore root::create_semaphore_for_export(vk::Device aDevice, const DISPATCH_LOADER_CORE_TYPE& aDispatchLoader, vk::ExternalSemaphoreHandleTypeFlags aHandleTypes, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation)
+	{
+		semaphore_t result;
+		result.mExportCreateInfo = vk::ExportSemaphoreCreateInfo{ aHandleTypes };
+		result.mCreateInfo = vk::SemaphoreCreateInfo{};
+
+		// Maybe alter the config?
+		if (aAlterConfigBeforeCreation) {
+			aAlterConfigBeforeCreation(result);
+		}
+
+		// Chain the export info in here, because result might have been moved in the meantime:
+		result.mCreateInfo.setPNext(&result.mExportCreateInfo);
+		result.mSemaphore = aDevice.createSemaphoreUnique(result.mCreateInfo, nullptr, aDispatchLoader);
+		return result;
+	}
+
+	semaphore root::create_semaphore_for_export(vk::ExternalSemaphoreHandleTypeFlags aHandleTypes, std::function<void(semaphore_t&)> aAlterConfigBeforeCreation)
+	{
+		return create_semaphore_for_export(device(), dispatch_loader_core(), aHandleTypes, std::move(aAlterConfigBeforeCreation));
+	}
+
+	int semaphore_t::export_sync_fd(const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader) const
+	{
+		return mSemaphore.getOwner().getSemaphoreFdKHR(vk::SemaphoreGetFdInfoKHR{ handle(), vk::ExternalSemaphoreHandleTypeFlagBits::eSyncFd }, aDispatchLoader);
+	}
+
+	uint64_t semaphore_t::current_value() const
+	{
+		assert(is_timeline_semaphore());
+		return mSemaphore.getOwner().getSemaphoreCounterValue(handle());
+	}
+
+	bool semaphore_t::wait(uint64_t aValue, std::optional<uint64_t> aTimeout) const
+	{
+		assert(is_timeline_semaphore());
+		auto waitInfo = vk::SemaphoreWaitInfo{}
+			.setSemaphoreCount(1u)
+			.setPSemaphores(handle_addr())
+			.setPValues(&aValue);
+		auto result = mSemaphore.getOwner().waitSemaphores(waitInfo, aTimeout.value_or(UINT64_MAX));
+		assert(static_cast<VkResult>(result) >= 0);
+		return vk::Result::eSuccess == result;
+	}
+
+	void semaphore_t::signal(uint64_t aValue) const
+	{
+		assert(is_timeline_semaphore());
+		mSemaphore.getOwner().signalSemaphore(vk::SemaphoreSignalInfo{ handle(), aValue });
+	}
+
 	semaphore_t& semaphore_t::handle_lifetime_of(any_owning_resource_t aResource)
 	{
 		mLifetimeHandledResources.push_back(std::move(aResource));
@@ -7609,11 +9006,11 @@ namespace avk
 #pragma endregion
 
 #pragma region commands and sync
-	inline static void record_into_command_buffer(command_buffer_t& aCommandBuffer, const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader, const std::vector<recorded_commands_t>& aRecordedCommandsAndSyncInstructions);
+	inline static void record_into_command_buffer(command_buffer_t& aCommandBuffer, const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader, std::span<const recorded_commands_t> aRecordedCommandsAndSyncInstructions);
 
 	template <typename T>
 	inline static T accumulate_sync_details(
-		const std::vector<recorded_commands_t>& aRecordedCommandsAndSyncInstructions,
+		std::span<const recorded_commands_t> aRecordedCommandsAndSyncInstructions,
 		const int aStartIndex,
 		uint32_t aNumSteps,
 		const int aStepDirection,
@@ -7723,7 +9120,7 @@ namespace avk
 	template <typename T>
 	inline static T assemble_barrier_data(
 		const sync::sync_type_command& aBarrierData, 
-		const std::vector<recorded_commands_t>& aRecordedCommandsAndSyncInstructions,
+		std::span<const recorded_commands_t> aRecordedCommandsAndSyncInstructions,
 		int aRecordedStuffIndex
 	) {
 		// Sanity check: Does T and aBarrierData fit together?
@@ -7917,7 +9314,7 @@ namespace avk
 		command_buffer_t& aCommandBuffer, 
 		const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader, 
 		const sync::sync_type_command& aSyncCmd, 
-		const std::vector<recorded_commands_t>& aRecordedCommandsAndSyncInstructions, 
+		std::span<const recorded_commands_t> aRecordedCommandsAndSyncInstructions, 
 		int aRecordedStuffIndex)
 	{
 		if (aSyncCmd.is_global_execution_barrier() || aSyncCmd.is_global_memory_barrier()) {
@@ -7956,7 +9353,7 @@ namespace avk
 
 	void command_buffer_t::record(const avk::sync::sync_type_command& aToBeRecorded)
 	{
-		record_into_command_buffer(*this, root_ptr()->dispatch_loader_ext(), aToBeRecorded, std::vector<recorded_commands_t>{}, 0);
+		record_into_command_buffer(*this, root_ptr()->dispatch_loader_ext(), aToBeRecorded, std::span<const recorded_commands_t>{}, 0);
 	}
 
 	void command_buffer_t::record(std::vector<avk::recorded_commands_t> aRecordedCommandsAndSyncInstructions)
@@ -7965,6 +9362,27 @@ namespace avk
 			.into_command_buffer(*this, false); // Last parameter: do not call begin/end here!
 	}
 
+	// Moves the lifetime-handled resources of all the given action-type commands, including nested ones, into the command buffer:
+	static void take_over_lifetimes(command_buffer_t& aCommandBuffer, std::span<avk::recorded_commands_t> aRecordedCommandsAndSyncInstructions)
+	{
+		for (auto& recordee : aRecordedCommandsAndSyncInstructions) {
+			if (std::holds_alternative<avk::command::action_type_command>(recordee)) {
+				auto& actionCmd = std::get<avk::command::action_type_command>(recordee);
+				for (auto& lifetime : actionCmd.mLifetimeHandledResources) {
+					aCommandBuffer.handle_lifetime_of(std::move(lifetime));
+				}
+				actionCmd.mLifetimeHandledResources.clear();
+				take_over_lifetimes(aCommandBuffer, actionCmd.mNestedCommandsAndSyncInstructions);
+			}
+		}
+	}
+
+	void command_buffer_t::record_and_take_over_lifetimes(std::span<avk::recorded_commands_t> aRecordedCommandsAndSyncInstructions)
+	{
+		take_over_lifetimes(*this, aRecordedCommandsAndSyncInstructions);
+		record_into_command_buffer(*this, root_ptr()->dispatch_loader_ext(), aRecordedCommandsAndSyncInstructions);
+	}
+
 
 	struct recordee_visitors
 	{
@@ -7981,11 +9399,11 @@ namespace avk
 
 		command_buffer_t& mCommandBuffer;
 		const DISPATCH_LOADER_EXT_TYPE& mDispatchLoaderExt;
-		const std::vector<recorded_commands_t>& mRecordedStuff;
+		std::span<const recorded_commands_t> mRecordedStuff;
 		int mCurrentIndexIntoRecordedStuff;
 	};
 	
-	inline static void record_into_command_buffer(command_buffer_t& aCommandBuffer, const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader, const std::vector<recorded_commands_t>& aRecordedCommandsAndSyncInstructions)
+	inline static void record_into_command_buffer(command_buffer_t& aCommandBuffer, const DISPATCH_LOADER_EXT_TYPE& aDispatchLoader, std::span<const recorded_commands_t> aRecordedCommandsAndSyncInstructions)
 	{
 		recordee_visitors visitState{ aCommandBuffer, aDispatchLoader, aRecordedCommandsAndSyncInstructions, /* Current index: */ 0 };
 		
@@ -8107,46 +9525,149 @@ namespace avk
 		return result;
 	}
 
-	namespace command
+	compiled_commands recorded_commands::and_compile()
 	{
-		action_type_command begin_render_pass_for_framebuffer(const renderpass_t& aRenderpass, const framebuffer_t& aFramebuffer, vk::Offset2D aRenderAreaOffset, std::optional<vk::Extent2D> aRenderAreaExtent, bool aSubpassesInline)
-		{
-			return action_type_command{
-				// Define a sync hint that corresponds to the implicit subpass dependencies (see specification chapter 8.1)
-				avk::sync::sync_hint {
-					{{ // What previous commands must synchronize with:
-						vk::PipelineStageFlagBits2KHR::eAllCommands, // eAllGraphics does not include new stages or ext-stages. Therefore, eAllCommands!
-						vk::AccessFlagBits2KHR::eInputAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentRead | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
-					}},
-					{{ // What subsequent commands must synchronize with:
-						vk::PipelineStageFlagBits2KHR::eAllCommands, // Same comment as above regarding eAllCommands vs. eAllGraphics
-						vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
-					}}
-				},
-				{},
-				[
-					lRoot = aRenderpass.root_ptr(),
-					lExtent = aFramebuffer.image_view_at(0)->get_image().create_info().extent,
-					lClearValues = aRenderpass.clear_values(),
-					lRenderPassHandle = aRenderpass.handle(),
-					lFramebufferHandle = aFramebuffer.handle(),
-					aRenderAreaOffset, aRenderAreaExtent, aSubpassesInline
-				](avk::command_buffer_t& cb) {
-					// TODO: make vk::SubpassContentscontents state explicit
-					cb.save_subpass_contents_state(aSubpassesInline ? vk::SubpassContents::eInline : vk::SubpassContents::eSecondaryCommandBuffers);
+		return compiled_commands{ mRoot, std::move(mRecordedCommandsAndSyncInstructions), std::move(mLifetimeHandledResources) };
+	}
 
-					auto renderPassBeginInfo = vk::RenderPassBeginInfo()
-						.setRenderPass(lRenderPassHandle)
-						.setFramebuffer(lFramebufferHandle)
-						.setRenderArea(vk::Rect2D{}
-							.setOffset(vk::Offset2D{ aRenderAreaOffset.x, aRenderAreaOffset.y })
-							.setExtent(aRenderAreaExtent.has_value()
-										? vk::Extent2D{ aRenderAreaExtent.value() }
-										: vk::Extent2D{ lExtent.width, lExtent.height }
-								)
-							)
-						.setClearValueCount(static_cast<uint32_t>(lClearValues.size()))
-						.setPClearValues(lClearValues.data());
+	compiled_commands::compiled_commands(const root* aRoot, std::vector<recorded_commands_t> aRecordedCommandsAndSyncInstructions, std::vector<any_owning_resource_t> aLifetimeHandledResources)
+		: mRoot{ aRoot }
+		, mRecordedCommandsAndSyncInstructions{ std::move(aRecordedCommandsAndSyncInstructions) }
+		, mLifetimeHandledResources{ std::move(aLifetimeHandledResources) }
+	{
+		for (auto& recordee : mRecordedCommandsAndSyncInstructions) {
+			if (std::holds_alternative<avk::command::action_type_command>(recordee)) {
+				for (auto& lifetime : std::get<avk::command::action_type_command>(recordee).mLifetimeHandledResources) {
+					mLifetimeHandledResources.push_back(std::move(lifetime));
+				}
+				std::get<avk::command::action_type_command>(recordee).mLifetimeHandledResources.clear();
+			}
+		}
+
+		compile(mRecordedCommandsAndSyncInstructions);
+
+		// All barriers are in place => their addresses won't change anymore, and the dependency infos can be assembled:
+		mDependencyInfos.reserve(mMemoryBarriers.size() + mImageMemoryBarriers.size() + mBufferMemoryBarriers.size());
+		for (auto& rec : mRecords) {
+			switch (rec.mType) {
+			case record_type::memory_barrier:
+				mDependencyInfos.push_back(vk::DependencyInfoKHR{}
+					.setMemoryBarrierCount(1u)
+					.setPMemoryBarriers(&mMemoryBarriers[rec.mIndex]));
+				break;
+			case record_type::image_memory_barrier:
+				mDependencyInfos.push_back(vk::DependencyInfoKHR{}
+					.setImageMemoryBarrierCount(1u)
+					.setPImageMemoryBarriers(&mImageMemoryBarriers[rec.mIndex]));
+				break;
+			case record_type::buffer_memory_barrier:
+				mDependencyInfos.push_back(vk::DependencyInfoKHR{}
+					.setBufferMemoryBarrierCount(1u)
+					.setPBufferMemoryBarriers(&mBufferMemoryBarriers[rec.mIndex]));
+				break;
+			default:
+				continue;
+			}
+			rec = record{ record_type::barrier, static_cast<uint32_t>(mDependencyInfos.size() - 1) };
+		}
+	}
+
+	void compiled_commands::add_invoke(const std::function<void(avk::command_buffer_t&)>& aFun)
+	{
+		if (!aFun) {
+			return;
+		}
+		mFunctions.push_back(&aFun);
+		mRecords.push_back(record{ record_type::invoke, static_cast<uint32_t>(mFunctions.size() - 1) });
+	}
+
+	void compiled_commands::compile(std::span<const recorded_commands_t> aRecordedCommandsAndSyncInstructions)
+	{
+		const int n = static_cast<int>(aRecordedCommandsAndSyncInstructions.size());
+		for (int i = 0; i < n; ++i) {
+			std::visit(lambda_overload{
+				[this](const command::state_type_command& bStateCmd) {
+					add_invoke(bStateCmd.mFun);
+				},
+				[this](const command::action_type_command& bActionCmd) {
+					add_invoke(bActionCmd.mBeginFun);
+					if (!bActionCmd.mNestedCommandsAndSyncInstructions.empty()) {
+						compile(bActionCmd.mNestedCommandsAndSyncInstructions);
+					}
+					add_invoke(bActionCmd.mEndFun);
+				},
+				[this, aRecordedCommandsAndSyncInstructions, i](const sync::sync_type_command& bSyncCmd) {
+					if (bSyncCmd.is_global_execution_barrier() || bSyncCmd.is_global_memory_barrier()) {
+						mMemoryBarriers.push_back(assemble_barrier_data<vk::MemoryBarrier2KHR>(bSyncCmd, aRecordedCommandsAndSyncInstructions, i));
+						mRecords.push_back(record{ record_type::memory_barrier, static_cast<uint32_t>(mMemoryBarriers.size() - 1) });
+					}
+					else if (bSyncCmd.is_image_memory_barrier()) {
+						mImageMemoryBarriers.push_back(assemble_barrier_data<vk::ImageMemoryBarrier2KHR>(bSyncCmd, aRecordedCommandsAndSyncInstructions, i));
+						mRecords.push_back(record{ record_type::image_memory_barrier, static_cast<uint32_t>(mImageMemoryBarriers.size() - 1) });
+					}
+					else if (bSyncCmd.is_buffer_memory_barrier()) {
+						mBufferMemoryBarriers.push_back(assemble_barrier_data<vk::BufferMemoryBarrier2KHR>(bSyncCmd, aRecordedCommandsAndSyncInstructions, i));
+						mRecords.push_back(record{ record_type::buffer_memory_barrier, static_cast<uint32_t>(mBufferMemoryBarriers.size() - 1) });
+					}
+				}
+			}, aRecordedCommandsAndSyncInstructions[i]);
+		}
+	}
+
+	void compiled_commands::replay_into(avk::command_buffer_t& aCommandBuffer) const
+	{
+		assert(nullptr != mRoot || mRecords.empty());
+		for (const auto& rec : mRecords) {
+			if (record_type::invoke == rec.mType) {
+				(*mFunctions[rec.mIndex])(aCommandBuffer);
+			}
+			else {
+				assert(record_type::barrier == rec.mType);
+				aCommandBuffer.handle().pipelineBarrier2KHR(mDependencyInfos[rec.mIndex], mRoot->dispatch_loader_ext());
+			}
+		}
+	}
+
+	namespace command
+	{
+		action_type_command begin_render_pass_for_framebuffer(const renderpass_t& aRenderpass, const framebuffer_t& aFramebuffer, vk::Offset2D aRenderAreaOffset, std::optional<vk::Extent2D> aRenderAreaExtent, bool aSubpassesInline)
+		{
+			return action_type_command{
+				// Define a sync hint that corresponds to the implicit subpass dependencies (see specification chapter 8.1)
+				avk::sync::sync_hint {
+					{{ // What previous commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eAllCommands, // eAllGraphics does not include new stages or ext-stages. Therefore, eAllCommands!
+						vk::AccessFlagBits2KHR::eInputAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentRead | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
+					}},
+					{{ // What subsequent commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eAllCommands, // Same comment as above regarding eAllCommands vs. eAllGraphics
+						vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
+					}}
+				},
+				{},
+				[
+					lRoot = aRenderpass.root_ptr(),
+					lExtent = aFramebuffer.image_view_at(0)->get_image().create_info().extent,
+					lClearValues = aRenderpass.clear_values(),
+					lRenderPassHandle = aRenderpass.handle(),
+					lFramebufferHandle = aFramebuffer.handle(),
+					aRenderAreaOffset, aRenderAreaExtent, aSubpassesInline
+				](avk::command_buffer_t& cb) {
+					// TODO: make vk::SubpassContentscontents state explicit
+					cb.save_subpass_contents_state(aSubpassesInline ? vk::SubpassContents::eInline : vk::SubpassContents::eSecondaryCommandBuffers);
+
+					auto renderPassBeginInfo = vk::RenderPassBeginInfo()
+						.setRenderPass(lRenderPassHandle)
+						.setFramebuffer(lFramebufferHandle)
+						.setRenderArea(vk::Rect2D{}
+							.setOffset(vk::Offset2D{ aRenderAreaOffset.x, aRenderAreaOffset.y })
+							.setExtent(aRenderAreaExtent.has_value()
+										? vk::Extent2D{ aRenderAreaExtent.value() }
+										: vk::Extent2D{ lExtent.width, lExtent.height }
+								)
+							)
+						.setClearValueCount(static_cast<uint32_t>(lClearValues.size()))
+						.setPClearValues(lClearValues.data());
 
 					cb.handle().beginRenderPass2KHR(
 						renderPassBeginInfo,
@@ -8186,20 +9707,11 @@ namespace avk
 			std::optional<vk::Extent2D> aRenderAreaExtent,
 			bool aSubpassesInline)
 		{
-			auto tmpBeginRenderPass = begin_render_pass_for_framebuffer(aRenderpass, aFramebuffer, aRenderAreaOffset, aRenderAreaExtent, aSubpassesInline);
-			auto tmpEndRenderPass = end_render_pass();
-
-			return action_type_command{
-				// Define a sync hint that corresponds to the implicit subpass dependencies (see specification chapter 8.1)
-				avk::sync::sync_hint {
-					tmpBeginRenderPass.mSyncHint.mDstForPreviousCmds,
-					tmpEndRenderPass.mSyncHint.mSrcForSubsequentCmds
-				},
-				std::move(tmpBeginRenderPass.mResourceSpecificSyncHints),
-				std::move(tmpBeginRenderPass.mBeginFun),
-				std::move(aNestedCommands),
-				std::move(tmpEndRenderPass.mBeginFun)
-			};
+			// The nested commands are stored in a list which allocates from the default memory resource:
+			return render_pass(aRenderpass, aFramebuffer,
+				recorded_commands_arena_list(std::make_move_iterator(std::begin(aNestedCommands)), std::make_move_iterator(std::end(aNestedCommands))),
+				aRenderAreaOffset, aRenderAreaExtent, aSubpassesInline
+			);
 		}
 
 		action_type_command next_subpass(bool aSubpassesInline)
@@ -8216,13 +9728,130 @@ namespace avk
 			};
 		}
 
+		action_type_command begin_rendering(
+			std::vector<rendering_attachment> aColorAttachments,
+			std::optional<rendering_attachment> aDepthStencilAttachment,
+			vk::Offset2D aRenderAreaOffset,
+			std::optional<vk::Extent2D> aRenderAreaExtent,
+			uint32_t aLayerCount,
+			bool aContentsInline)
+		{
+			if (aColorAttachments.empty() && !aDepthStencilAttachment.has_value()) {
+				throw avk::logic_error("At least one attachment must be passed to begin_rendering.");
+			}
+
+			// Determine the default render area from the first attachment, i.e., from the extent of its view's base mip level:
+			const auto& firstAttachment = aColorAttachments.empty() ? aDepthStencilAttachment.value() : aColorAttachments.front();
+			const auto& firstExtent = firstAttachment.mImageView->get_image().create_info().extent;
+			const auto firstMipLevel = firstAttachment.mImageView->create_info().subresourceRange.baseMipLevel;
+			const auto renderArea = vk::Rect2D{}
+				.setOffset(aRenderAreaOffset)
+				.setExtent(aRenderAreaExtent.value_or(vk::Extent2D{ std::max(firstExtent.width >> firstMipLevel, 1u), std::max(firstExtent.height >> firstMipLevel, 1u) }));
+
+			std::vector<vk::RenderingAttachmentInfoKHR> colorAttachmentInfos;
+			colorAttachmentInfos.reserve(aColorAttachments.size());
+			for (const auto& a : aColorAttachments) {
+				if (a.is_depth_stencil_attachment()) {
+					throw avk::logic_error("A depth/stencil attachment has been passed as color attachment to begin_rendering.");
+				}
+				colorAttachmentInfos.push_back(a.to_vk_rendering_attachment_info());
+			}
+			std::optional<vk::RenderingAttachmentInfoKHR> depthAttachmentInfo;
+			std::optional<vk::RenderingAttachmentInfoKHR> stencilAttachmentInfo;
+			if (aDepthStencilAttachment.has_value()) {
+				if (!aDepthStencilAttachment->is_depth_stencil_attachment()) {
+					throw avk::logic_error("The depth/stencil attachment passed to begin_rendering has neither a depth nor a stencil component.");
+				}
+				if (aDepthStencilAttachment->has_depth_component()) {
+					depthAttachmentInfo = aDepthStencilAttachment->to_vk_rendering_attachment_info();
+				}
+				if (aDepthStencilAttachment->has_stencil_component()) {
+					stencilAttachmentInfo = aDepthStencilAttachment->to_vk_rendering_attachment_info(true);
+				}
+			}
+
+			return action_type_command{
+				// Define a sync hint that corresponds to the one of begin_render_pass_for_framebuffer
+				avk::sync::sync_hint {
+					{{ // What previous commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eAllCommands, // eAllGraphics does not include new stages or ext-stages. Therefore, eAllCommands!
+						vk::AccessFlagBits2KHR::eInputAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentRead | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
+					}},
+					{{ // What subsequent commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eAllCommands, // Same comment as above regarding eAllCommands vs. eAllGraphics
+						vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
+					}}
+				},
+				{},
+				[
+					lColorAttachmentInfos = std::move(colorAttachmentInfos),
+					lDepthAttachmentInfo = std::move(depthAttachmentInfo),
+					lStencilAttachmentInfo = std::move(stencilAttachmentInfo),
+					renderArea, aLayerCount, aContentsInline
+				](avk::command_buffer_t& cb) {
+					cb.save_subpass_contents_state(aContentsInline ? vk::SubpassContents::eInline : vk::SubpassContents::eSecondaryCommandBuffers);
+
+					// The attachment infos are stored in this lambda, i.e., their addresses are valid until recording has completed:
+					auto renderingInfo = vk::RenderingInfoKHR{}
+						.setFlags(aContentsInline ? vk::RenderingFlagsKHR{} : vk::RenderingFlagsKHR{ vk::RenderingFlagBitsKHR::eContentsSecondaryCommandBuffers })
+						.setRenderArea(renderArea)
+						.setLayerCount(aLayerCount)
+						.setViewMask(0u)
+						.setColorAttachmentCount(static_cast<uint32_t>(lColorAttachmentInfos.size()))
+						.setPColorAttachments(lColorAttachmentInfos.data())
+						.setPDepthAttachment(lDepthAttachmentInfo.has_value() ? &lDepthAttachmentInfo.value() : nullptr)
+						.setPStencilAttachment(lStencilAttachmentInfo.has_value() ? &lStencilAttachmentInfo.value() : nullptr);
+
+					cb.handle().beginRenderingKHR(renderingInfo, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		action_type_command end_rendering()
+		{
+			return action_type_command{
+				// Define a sync hint that corresponds to the one of end_render_pass
+				avk::sync::sync_hint {
+					{{ // What previous commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eAllCommands, // eAllGraphics does not include new stages or ext-stages. Therefore, eAllCommands!
+						vk::AccessFlagBits2KHR::eInputAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentRead | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
+					}},
+					{{ // What subsequent commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eAllCommands, // Same comment as above regarding eAllCommands vs. eAllGraphics
+						vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
+					}}
+				},
+				{},
+				[](avk::command_buffer_t& cb) {
+					cb.handle().endRenderingKHR(cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		action_type_command rendering(
+			std::vector<rendering_attachment> aColorAttachments,
+			std::optional<rendering_attachment> aDepthStencilAttachment,
+			std::vector<recorded_commands_t> aNestedCommands,
+			vk::Offset2D aRenderAreaOffset,
+			std::optional<vk::Extent2D> aRenderAreaExtent,
+			uint32_t aLayerCount,
+			bool aContentsInline)
+		{
+			// The nested commands are stored in a list which allocates from the default memory resource:
+			return rendering(std::move(aColorAttachments), std::move(aDepthStencilAttachment),
+				recorded_commands_arena_list(std::make_move_iterator(std::begin(aNestedCommands)), std::make_move_iterator(std::end(aNestedCommands))),
+				aRenderAreaOffset, aRenderAreaExtent, aLayerCount, aContentsInline
+			);
+		}
+
 		state_type_command bind_pipeline(const graphics_pipeline_t& aPipeline)
 		{
 			return state_type_command{
 				[
-					lPipelineHandle = aPipeline.handle()
+					lPipelineHandle = aPipeline.handle(),
+					lLayoutHandle = aPipeline.layout_handle()
 				] (avk::command_buffer_t& cb) {
-					cb.handle().bindPipeline(vk::PipelineBindPoint::eGraphics, lPipelineHandle);
+					cb.bind_pipeline(vk::PipelineBindPoint::eGraphics, lPipelineHandle, lLayoutHandle);
 				}
 			};
 		}
@@ -8231,9 +9860,10 @@ namespace avk
 		{
 			return state_type_command{
 				[
-					lPipelineHandle = aPipeline.handle()
+					lPipelineHandle = aPipeline.handle(),
+					lLayoutHandle = aPipeline.layout_handle()
 				] (avk::command_buffer_t& cb) {
-					cb.handle().bindPipeline(vk::PipelineBindPoint::eCompute, lPipelineHandle);
+					cb.bind_pipeline(vk::PipelineBindPoint::eCompute, lPipelineHandle, lLayoutHandle);
 				}
 			};
 		}
@@ -8243,94 +9873,297 @@ namespace avk
 		{
 			return state_type_command{
 				[
-					lPipelineHandle = aPipeline.handle()
+					lPipelineHandle = aPipeline.handle(),
+					lLayoutHandle = aPipeline.layout_handle()
 				] (avk::command_buffer_t& cb) {
-					cb.handle().bindPipeline(vk::PipelineBindPoint::eRayTracingKHR, lPipelineHandle);
+					cb.bind_pipeline(vk::PipelineBindPoint::eRayTracingKHR, lPipelineHandle, lLayoutHandle);
+				}
+			};
+		}
+#endif
+
+		state_type_command set_culling_mode(cfg::culling_mode aCullingMode)
+		{
+			return state_type_command{
+				[lCullMode = to_vk_cull_mode(aCullingMode)](avk::command_buffer_t& cb) {
+					cb.handle().setCullModeEXT(lCullMode, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_front_face(cfg::front_face aFrontFace)
+		{
+			return state_type_command{
+				[lFrontFace = to_vk_front_face(aFrontFace.winding_order_of_front_faces())](avk::command_buffer_t& cb) {
+					cb.handle().setFrontFaceEXT(lFrontFace, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_primitive_topology(cfg::primitive_topology aPrimitiveTopology)
+		{
+			return state_type_command{
+				[lTopology = to_vk_primitive_topology(aPrimitiveTopology)](avk::command_buffer_t& cb) {
+					cb.handle().setPrimitiveTopologyEXT(lTopology, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_depth_test(cfg::depth_test aDepthTest)
+		{
+			return state_type_command{
+				[
+					lEnabled = to_vk_bool(aDepthTest.is_enabled()),
+					lCompareOp = to_vk_compare_op(aDepthTest.depth_compare_operation())
+				](avk::command_buffer_t& cb) {
+					cb.handle().setDepthTestEnableEXT(lEnabled, cb.root_ptr()->dispatch_loader_ext());
+					cb.handle().setDepthCompareOpEXT(lCompareOp, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_depth_write(cfg::depth_write aDepthWrite)
+		{
+			return state_type_command{
+				[lEnabled = to_vk_bool(aDepthWrite.is_enabled())](avk::command_buffer_t& cb) {
+					cb.handle().setDepthWriteEnableEXT(lEnabled, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_depth_bounds_test(bool aEnabled)
+		{
+			return state_type_command{
+				[lEnabled = to_vk_bool(aEnabled)](avk::command_buffer_t& cb) {
+					cb.handle().setDepthBoundsTestEnableEXT(lEnabled, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_stencil_test(cfg::stencil_test aStencilTest)
+		{
+			return state_type_command{
+				[
+					lEnabled = to_vk_bool(aStencilTest.mEnabled),
+					lFront = vk::StencilOpState{ aStencilTest.mFrontStencilTestActions },
+					lBack = vk::StencilOpState{ aStencilTest.mBackStencilTestActions }
+				](avk::command_buffer_t& cb) {
+					cb.handle().setStencilTestEnableEXT(lEnabled, cb.root_ptr()->dispatch_loader_ext());
+					cb.handle().setStencilOpEXT(vk::StencilFaceFlagBits::eFront, lFront.failOp, lFront.passOp, lFront.depthFailOp, lFront.compareOp, cb.root_ptr()->dispatch_loader_ext());
+					cb.handle().setStencilOpEXT(vk::StencilFaceFlagBits::eBack, lBack.failOp, lBack.passOp, lBack.depthFailOp, lBack.compareOp, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_rasterizer_geometry_mode(cfg::rasterizer_geometry_mode aRasterizerGeometryMode)
+		{
+			return state_type_command{
+				[lDiscard = to_vk_bool(cfg::rasterizer_geometry_mode::discard_geometry == aRasterizerGeometryMode)](avk::command_buffer_t& cb) {
+					cb.handle().setRasterizerDiscardEnableEXT(lDiscard, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_depth_bias_enabled(bool aEnabled)
+		{
+			return state_type_command{
+				[lEnabled = to_vk_bool(aEnabled)](avk::command_buffer_t& cb) {
+					cb.handle().setDepthBiasEnableEXT(lEnabled, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_primitive_restart_enabled(bool aEnabled)
+		{
+			return state_type_command{
+				[lEnabled = to_vk_bool(aEnabled)](avk::command_buffer_t& cb) {
+					cb.handle().setPrimitiveRestartEnableEXT(lEnabled, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+#if VK_HEADER_VERSION >= 233
+		state_type_command set_polygon_drawing_mode(cfg::polygon_drawing_mode aPolygonDrawingMode)
+		{
+			return state_type_command{
+				[lPolygonMode = to_vk_polygon_mode(aPolygonDrawingMode)](avk::command_buffer_t& cb) {
+					cb.handle().setPolygonModeEXT(lPolygonMode, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_depth_clamp_enabled(bool aEnabled)
+		{
+			return state_type_command{
+				[lEnabled = to_vk_bool(aEnabled)](avk::command_buffer_t& cb) {
+					cb.handle().setDepthClampEnableEXT(lEnabled, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_color_blending_enabled(std::vector<bool> aEnabled, uint32_t aFirstAttachment)
+		{
+			std::vector<vk::Bool32> enabled;
+			enabled.reserve(aEnabled.size());
+			for (bool e : aEnabled) {
+				enabled.push_back(to_vk_bool(e));
+			}
+			return state_type_command{
+				[lEnabled = std::move(enabled), aFirstAttachment](avk::command_buffer_t& cb) {
+					cb.handle().setColorBlendEnableEXT(aFirstAttachment, lEnabled, cb.root_ptr()->dispatch_loader_ext());
+				}
+			};
+		}
+
+		state_type_command set_color_write_mask(std::vector<cfg::color_channel> aColorChannels, uint32_t aFirstAttachment)
+		{
+			std::vector<vk::ColorComponentFlags> writeMasks;
+			writeMasks.reserve(aColorChannels.size());
+			for (auto c : aColorChannels) {
+				writeMasks.push_back(to_vk_color_components(c));
+			}
+			return state_type_command{
+				[lWriteMasks = std::move(writeMasks), aFirstAttachment](avk::command_buffer_t& cb) {
+					cb.handle().setColorWriteMaskEXT(aFirstAttachment, lWriteMasks, cb.root_ptr()->dispatch_loader_ext());
 				}
 			};
 		}
 #endif
 
-		state_type_command bind_descriptors(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets)
+		state_type_command bind_descriptors(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets, std::vector<uint32_t> aDynamicOffsets)
 		{
 			return state_type_command{
 				[
 					lLayoutHandle = std::get<const graphics_pipeline_t*>(aPipelineLayout)->layout_handle(),
-					lDescriptorSets = std::move(aDescriptorSets)
+					lDescriptorSets = std::move(aDescriptorSets),
+					lDynamicOffsets = std::move(aDynamicOffsets)
 				] (avk::command_buffer_t& cb) {
 					cb.bind_descriptors(
 						vk::PipelineBindPoint::eGraphics,
 						lLayoutHandle,
-						lDescriptorSets // Attention: Copy! => Potentially expensive?! TODO: What was the reason for bind_descriptors requiring std::vector<descriptor_set> being passed by value?
+						lDescriptorSets, // Attention: Copy! => Potentially expensive?! TODO: What was the reason for bind_descriptors requiring std::vector<descriptor_set> being passed by value?
+						lDynamicOffsets
 					);
 				}
 			};
 		}
 
-		state_type_command bind_descriptors(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets)
+		state_type_command bind_descriptors(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets, std::vector<uint32_t> aDynamicOffsets)
 		{
 			return state_type_command{
 				[
 					lLayoutHandle = std::get<const compute_pipeline_t*>(aPipelineLayout)->layout_handle(),
-					lDescriptorSets = std::move(aDescriptorSets)
+					lDescriptorSets = std::move(aDescriptorSets),
+					lDynamicOffsets = std::move(aDynamicOffsets)
 				] (avk::command_buffer_t& cb) {
 					cb.bind_descriptors(
 						vk::PipelineBindPoint::eCompute,
 						lLayoutHandle,
-						lDescriptorSets // Attention: Copy! => Potentially expensive?! TODO: What was the reason for bind_descriptors requiring std::vector<descriptor_set> being passed by value?
+						lDescriptorSets, // Attention: Copy! => Potentially expensive?! TODO: What was the reason for bind_descriptors requiring std::vector<descriptor_set> being passed by value?
+						lDynamicOffsets
 					);
 				}
 			};
 		}
 
 #if VK_HEADER_VERSION >= 135
-		state_type_command bind_descriptors(std::tuple<const ray_tracing_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets)
+		state_type_command bind_descriptors(std::tuple<const ray_tracing_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<descriptor_set> aDescriptorSets, std::vector<uint32_t> aDynamicOffsets)
 		{
 			return state_type_command{
 				[
 					lLayoutHandle = std::get<const ray_tracing_pipeline_t*>(aPipelineLayout)->layout_handle(),
-					lDescriptorSets = std::move(aDescriptorSets)
+					lDescriptorSets = std::move(aDescriptorSets),
+					lDynamicOffsets = std::move(aDynamicOffsets)
 				] (avk::command_buffer_t& cb) {
 					cb.bind_descriptors(
 						vk::PipelineBindPoint::eRayTracingKHR,
 						lLayoutHandle,
-						lDescriptorSets // Attention: Copy! => Potentially expensive?! TODO: What was the reason for bind_descriptors requiring std::vector<descriptor_set> being passed by value?
+						lDescriptorSets, // Attention: Copy! => Potentially expensive?! TODO: What was the reason for bind_descriptors requiring std::vector<descriptor_set> being passed by value?
+						lDynamicOffsets
 					);
 				}
 			};
 		}
 #endif 
 
-		action_type_command draw(uint32_t aVertexCount, uint32_t aInstanceCount, uint32_t aFirstVertex, uint32_t aFirstInstance)
+		state_type_command push_descriptors(std::tuple<const graphics_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<binding_data> aBindings)
 		{
-			return action_type_command{
-				avk::sync::sync_hint {
-					{{ // What previous commands must synchronize with:
-						vk::PipelineStageFlagBits2KHR::eAllGraphics,
-						vk::AccessFlagBits2KHR::eInputAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentRead | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
-					}},
-					{{ // What subsequent commands must synchronize with:
-						vk::PipelineStageFlagBits2KHR::eAllGraphics,
-						vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
-					}}
-				},
-				{},
-				[aVertexCount, aInstanceCount, aFirstVertex, aFirstInstance](avk::command_buffer_t& cb) {
-					cb.handle().draw(aVertexCount, aInstanceCount, aFirstVertex, aFirstInstance, cb.root_ptr()->dispatch_loader_core());
+			return state_type_command{
+				[
+					lLayoutHandle = std::get<const graphics_pipeline_t*>(aPipelineLayout)->layout_handle(),
+					lPreparedSet = descriptor_set::prepare(std::move(aBindings))
+				] (avk::command_buffer_t& cb) {
+					cb.push_descriptors(vk::PipelineBindPoint::eGraphics, lLayoutHandle, lPreparedSet);
 				}
 			};
 		}
 
-		action_type_command dispatch(uint32_t aGroupCountX, uint32_t aGroupCountY, uint32_t aGroupCountZ)
+		state_type_command push_descriptors(std::tuple<const compute_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<binding_data> aBindings)
 		{
-			return action_type_command{
-				avk::sync::sync_hint {
-					{{ // What previous commands must synchronize with:
-						vk::PipelineStageFlagBits2KHR::eComputeShader,
-						vk::AccessFlagBits2KHR::eShaderSampledRead | vk::AccessFlagBits2KHR::eShaderStorageRead | vk::AccessFlagBits2KHR::eShaderStorageWrite
-					}},
-					{{ // What subsequent commands must synchronize with:
-						vk::PipelineStageFlagBits2KHR::eComputeShader,
+			return state_type_command{
+				[
+					lLayoutHandle = std::get<const compute_pipeline_t*>(aPipelineLayout)->layout_handle(),
+					lPreparedSet = descriptor_set::prepare(std::move(aBindings))
+				] (avk::command_buffer_t& cb) {
+					cb.push_descriptors(vk::PipelineBindPoint::eCompute, lLayoutHandle, lPreparedSet);
+				}
+			};
+		}
+
+#if VK_HEADER_VERSION >= 135
+		state_type_command push_descriptors(std::tuple<const ray_tracing_pipeline_t*, const vk::PipelineLayout, const std::vector<vk::PushConstantRange>*> aPipelineLayout, std::vector<binding_data> aBindings)
+		{
+			return state_type_command{
+				[
+					lLayoutHandle = std::get<const ray_tracing_pipeline_t*>(aPipelineLayout)->layout_handle(),
+					lPreparedSet = descriptor_set::prepare(std::move(aBindings))
+				] (avk::command_buffer_t& cb) {
+					cb.push_descriptors(vk::PipelineBindPoint::eRayTracingKHR, lLayoutHandle, lPreparedSet);
+				}
+			};
+		}
+#endif
+
+		action_type_command draw(uint32_t aVertexCount, uint32_t aInstanceCount, uint32_t aFirstVertex, uint32_t aFirstInstance)
+		{
+			return action_type_command{
+				avk::sync::sync_hint {
+					{{ // What previous commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eAllGraphics,
+						vk::AccessFlagBits2KHR::eInputAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentRead | vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentRead | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
+					}},
+					{{ // What subsequent commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eAllGraphics,
+						vk::AccessFlagBits2KHR::eColorAttachmentWrite | vk::AccessFlagBits2KHR::eDepthStencilAttachmentWrite
+					}}
+				},
+				{},
+				[aVertexCount, aInstanceCount, aFirstVertex, aFirstInstance](avk::command_buffer_t& cb) {
+					cb.handle().draw(aVertexCount, aInstanceCount, aFirstVertex, aFirstInstance, cb.root_ptr()->dispatch_loader_core());
+				}
+			};
+		}
+
+		action_type_command draw(const vk::DrawIndirectCommand* aParametersPtr)
+		{
+			// Same sync hints as for the non-pointer variant, but read the parameters only at the time of recording:
+			auto result = draw(0u, 0u, 0u, 0u);
+			result.mBeginFun = [aParametersPtr](avk::command_buffer_t& cb) {
+				cb.handle().draw(aParametersPtr->vertexCount, aParametersPtr->instanceCount, aParametersPtr->firstVertex, aParametersPtr->firstInstance, cb.root_ptr()->dispatch_loader_core());
+			};
+			return result;
+		}
+
+		action_type_command dispatch(uint32_t aGroupCountX, uint32_t aGroupCountY, uint32_t aGroupCountZ)
+		{
+			return action_type_command{
+				avk::sync::sync_hint {
+					{{ // What previous commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eComputeShader,
+						vk::AccessFlagBits2KHR::eShaderSampledRead | vk::AccessFlagBits2KHR::eShaderStorageRead | vk::AccessFlagBits2KHR::eShaderStorageWrite
+					}},
+					{{ // What subsequent commands must synchronize with:
+						vk::PipelineStageFlagBits2KHR::eComputeShader,
 						vk::AccessFlagBits2KHR::eShaderStorageWrite
 					}}
 				},
@@ -8341,6 +10174,16 @@ namespace avk
 			};
 		}
 
+		action_type_command dispatch(const vk::DispatchIndirectCommand* aGroupCountsPtr)
+		{
+			// Same sync hints as for the non-pointer variant, but read the group counts only at the time of recording:
+			auto result = dispatch(0u, 0u, 0u);
+			result.mBeginFun = [aGroupCountsPtr](avk::command_buffer_t& cb) {
+				cb.handle().dispatch(aGroupCountsPtr->x, aGroupCountsPtr->y, aGroupCountsPtr->z, cb.root_ptr()->dispatch_loader_core());
+			};
+			return result;
+		}
+
 #if VK_HEADER_VERSION >= 135
 		action_type_command trace_rays(
 			vk::Extent3D aRaygenDimensions,
@@ -8393,6 +10236,7 @@ namespace avk
 		, mSemaphoreSignals{ std::move(aOther.mSemaphoreSignals) }
 		, mFence{ std::move(aOther.mFence) }
 		, mSubmissionCount{ std::move(aOther.mSubmissionCount) }
+		, mDangerousRecordedCommandBufferPointer{ std::move(aOther.mDangerousRecordedCommandBufferPointer) }
 	{
 		aOther.mRoot = nullptr;
 		aOther.mQueueToSubmitTo = nullptr;
@@ -8400,6 +10244,7 @@ namespace avk
 		aOther.mSemaphoreSignals.clear();
 		aOther.mFence.reset();
 		aOther.mSubmissionCount = 0u;
+		aOther.mDangerousRecordedCommandBufferPointer = nullptr;
 	}
 
 	submission_data& submission_data::operator=(submission_data&& aOther) noexcept
@@ -8411,6 +10256,7 @@ namespace avk
 		mSemaphoreSignals = std::move(aOther.mSemaphoreSignals);
 		mFence = std::move(aOther.mFence);
 		mSubmissionCount = std::move(aOther.mSubmissionCount);
+		mDangerousRecordedCommandBufferPointer = std::move(aOther.mDangerousRecordedCommandBufferPointer);
 
 		aOther.mRoot = nullptr;
 		aOther.mQueueToSubmitTo = nullptr;
@@ -8418,6 +10264,7 @@ namespace avk
 		aOther.mSemaphoreSignals.clear();
 		aOther.mFence.reset();
 		aOther.mSubmissionCount = 0u;
+		aOther.mDangerousRecordedCommandBufferPointer = nullptr;
 
 		return *this;
 	}
@@ -8458,12 +10305,11 @@ namespace avk
 		return std::move(*this);
 	}
 
-	void submission_data::submit()
+	void submission_data::gather_semaphore_submit_infos(std::vector<vk::SemaphoreSubmitInfoKHR>& aWaitSemaphoreInfos, std::vector<vk::SemaphoreSubmitInfoKHR>& aSignalSemaphoreInfos) const
 	{
 		// Gather config for wait semaphores:
-		std::vector<vk::SemaphoreSubmitInfoKHR> waitSem;
 		for (auto& semWait : mSemaphoreWaits) {
-			auto& subInfo = waitSem.emplace_back(semWait.mWaitSemaphore->handle()); // TODO: What about timeline semaphores? (see 'value' param!)
+			auto& subInfo = aWaitSemaphoreInfos.emplace_back(semWait.mWaitSemaphore->handle(), semWait.mValue); // The value is ignored for binary semaphores
 			std::visit(lambda_overload{
 				[&subInfo](const std::monostate&) {
 					subInfo.setStageMask(vk::PipelineStageFlagBits2KHR::eNone);
@@ -8494,9 +10340,8 @@ namespace avk
 		}
 
 		// Gather config for signal semaphores:
-		std::vector<vk::SemaphoreSubmitInfoKHR> signalSem;
 		for (auto& semSig : mSemaphoreSignals) {
-			auto& subInfo = signalSem.emplace_back(semSig.mSignalSemaphore->handle()); // TODO: What about timeline semaphores? (see 'value' param!)
+			auto& subInfo = aSignalSemaphoreInfos.emplace_back(semSig.mSignalSemaphore->handle(), semSig.mValue); // The value is ignored for binary semaphores
 			std::visit(lambda_overload{
 				[&subInfo](const std::monostate&) {
 					subInfo.setStageMask(vk::PipelineStageFlagBits2KHR::eNone);
@@ -8525,6 +10370,13 @@ namespace avk
 				}
 				}, semSig.mSrcStage.mFlags);
 		}
+	}
+
+	void submission_data::submit()
+	{
+		std::vector<vk::SemaphoreSubmitInfoKHR> waitSem;
+		std::vector<vk::SemaphoreSubmitInfoKHR> signalSem;
+		gather_semaphore_submit_infos(waitSem, signalSem);
 
 		auto cmdBfrSubmitInfo = vk::CommandBufferSubmitInfoKHR{}
 		.setCommandBuffer(mCommandBufferToSubmit->handle());
@@ -8543,8 +10395,1618 @@ namespace avk
 		++mSubmissionCount;
 	}
 
+	submission_awaiter submission_data::operator co_await() &&
+	{
+		return submission_awaiter{ std::move(*this), {} };
+	}
+
+	submission_awaiter submission_data::resumed_on(std::function<void(std::coroutine_handle<>)> aScheduler) &&
+	{
+		return submission_awaiter{ std::move(*this), std::move(aScheduler) };
+	}
+
+	submission_awaiter submission_data::awaited_with(completion_tracker_t& aFencePool, std::function<void(std::coroutine_handle<>)> aScheduler) &&
+	{
+		return submission_awaiter{ std::move(*this), std::move(aScheduler), &aFencePool };
+	}
+
+	int submission_data::submit_and_export_sync_fd()
+	{
+		if (!mFence.has_value()) {
+			auto exportableFence = root::create_fence_for_export(mRoot->device(), mRoot->dispatch_loader_core());
+			// The fence must stay alive until the submission has completed:
+			mCommandBufferToSubmit.get().handle_lifetime_of(exportableFence);
+			mFence = std::move(exportableFence);
+		}
+
+		// A sync fd can only be exported if the fence has a pending signal operation => submit first:
+		submit();
+		return mFence.value()->export_sync_fd(mRoot->dispatch_loader_ext());
+	}
+
+	struct submission_awaiter::waiter_thread
+	{
+		waiter_thread()
+			: mThread{ &waiter_thread::run, this }
+		{}
+
+		~waiter_thread()
+		{
+			{
+				std::scoped_lock lock{ mMutex };
+				mStop = true;
+			}
+			mAwaitersAdded.notify_all();
+			mThread.join();
+		}
+
+		static waiter_thread& instance()
+		{
+			static waiter_thread sInstance;
+			return sInstance;
+		}
+
+		void add(submission_awaiter* aAwaiter)
+		{
+			{
+				std::scoped_lock lock{ mMutex };
+				mAwaiters.push_back(aAwaiter);
+			}
+			mAwaitersAdded.notify_one();
+		}
+
+		void run()
+		{
+			std::vector<submission_awaiter*> completed;
+			std::unique_lock lock{ mMutex };
+			for (;;) {
+				mAwaitersAdded.wait(lock, [this]() { return mStop || !mAwaiters.empty(); });
+				if (mStop) {
+					return;
+				}
+
+				auto it = std::stable_partition(std::begin(mAwaiters), std::end(mAwaiters), [](submission_awaiter* lAwaiter) {
+					try {
+						return !lAwaiter->is_complete();
+					}
+					catch (...) {
+						// e.g., device lost => resume and let it rethrow from co_await
+						lAwaiter->mException = std::current_exception();
+						return false;
+					}
+				});
+				completed.assign(it, std::end(mAwaiters));
+				mAwaiters.erase(it, std::end(mAwaiters));
+
+				if (completed.empty()) {
+					// Nothing has completed => block until something does:
+					wait_for_any(lock);
+					continue;
+				}
+
+				lock.unlock();
+				for (auto* awaiter : completed) {
+					// The fence has been signaled => it can be used for further submissions:
+					if (nullptr != awaiter->mFencePool && awaiter->mCreatedFence.has_value()) {
+						try {
+							awaiter->mFencePool->recycle_fence(std::move(awaiter->mCreatedFence.value()));
+						}
+						catch (...) {
+							if (!awaiter->mException) {
+								awaiter->mException = std::current_exception();
+							}
+						}
+						awaiter->mCreatedFence.reset();
+					}
+
+					// The awaiter lives in the coroutine frame => do not touch it anymore after resuming:
+					auto coroutine = awaiter->mCoroutine;
+					auto scheduler = std::move(awaiter->mScheduler);
+					if (scheduler) {
+						scheduler(coroutine);
+					}
+					else {
+						coroutine.resume();
+					}
+				}
+				completed.clear();
+				lock.lock();
+			}
+		}
+
+		// Blocks until one of the awaited fences or timeline semaphores of the first awaiter's device is signaled.
+		// Only objects of the same device can be waited for at once, and awaiters which are added in the meantime
+		// are not part of the wait => the wait is bounded by a timeout, after which the caller checks everything again.
+		void wait_for_any(std::unique_lock<std::mutex>& aLock)
+		{
+			static constexpr uint64_t sWaitTimeoutNs = 1'000'000; // 1 ms
+			const vk::Device device = mAwaiters.front()->mSubmission.mRoot->device();
+			std::vector<vk::Fence> fences;
+			std::vector<vk::Semaphore> semaphores;
+			std::vector<uint64_t> values;
+			for (auto* awaiter : mAwaiters) {
+				if (awaiter->mSubmission.mRoot->device() != device) {
+					continue;
+				}
+				if (nullptr != awaiter->mTimelineSemaphoreToWaitFor) {
+					semaphores.push_back(awaiter->mTimelineSemaphoreToWaitFor->handle());
+					values.push_back(awaiter->mTimelineValueToWaitFor);
+				}
+				else {
+					fences.push_back(awaiter->mFenceToWaitFor->handle());
+				}
+			}
+
+			// Only this thread removes awaiters => the gathered handles stay valid while the lock is released:
+			aLock.unlock();
+			try {
+				if (!fences.empty()) {
+					// ReSharper disable once CppExpressionWithoutSideEffects
+					auto result = device.waitForFences(static_cast<uint32_t>(fences.size()), fences.data(), VK_FALSE, sWaitTimeoutNs);
+				}
+				if (!semaphores.empty()) {
+					// ReSharper disable once CppExpressionWithoutSideEffects
+					auto result = device.waitSemaphores(vk::SemaphoreWaitInfo{}
+						.setFlags(vk::SemaphoreWaitFlagBits::eAny)
+						.setSemaphoreCount(static_cast<uint32_t>(semaphores.size()))
+						.setPSemaphores(semaphores.data())
+						.setPValues(values.data()),
+						fences.empty() ? sWaitTimeoutNs : 0);
+				}
+			}
+			catch (...) {
+				// e.g., device lost => is_complete() will throw again and hand the exception to the awaiters
+			}
+			aLock.lock();
+		}
+
+		std::mutex mMutex;
+		std::condition_variable mAwaitersAdded;
+		std::vector<submission_awaiter*> mAwaiters;
+		bool mStop = false;
+		std::thread mThread;
+	};
+
+	bool submission_awaiter::await_suspend(std::coroutine_handle<> aCoroutine)
+	{
+		try {
+			// Prefer waiting for a timeline semaphore value; otherwise wait for a fence:
+			for (const auto& semSig : mSubmission.mSemaphoreSignals) {
+				if (semSig.mSignalSemaphore->is_timeline_semaphore()) {
+					mTimelineSemaphoreToWaitFor = &*semSig.mSignalSemaphore;
+					mTimelineValueToWaitFor = semSig.mValue;
+				}
+			}
+			if (nullptr == mTimelineSemaphoreToWaitFor) {
+				if (!mSubmission.mFence.has_value()) {
+					mCreatedFence = nullptr != mFencePool
+						? mFencePool->acquire_fence()
+						: root::create_fence(mSubmission.mRoot->device(), mSubmission.mRoot->dispatch_loader_core());
+					mSubmission.signaling_upon_completion(mCreatedFence.value()); // <-- Shared ownership => stays alive
+				}
+				mFenceToWaitFor = &*mSubmission.mFence.value();
+			}
+
+			mSubmission.submit();
+		}
+		catch (...) {
+			// Do not suspend, but rethrow from await_resume. The submission must not be attempted again in its destructor:
+			mSubmission.mSubmissionCount = std::max(mSubmission.mSubmissionCount, 1u);
+			mException = std::current_exception();
+			if (nullptr != mFencePool && mCreatedFence.has_value()) {
+				mFencePool->recycle_fence(std::move(mCreatedFence.value()));
+				mCreatedFence.reset();
+			}
+			return false;
+		}
+
+		mCoroutine = aCoroutine;
+		waiter_thread::instance().add(this);
+		return true;
+	}
+
+	void submission_awaiter::await_resume() const
+	{
+		if (mException) {
+			std::rethrow_exception(mException);
+		}
+	}
+
+	bool submission_awaiter::is_complete() const
+	{
+		if (nullptr != mTimelineSemaphoreToWaitFor) {
+			return mTimelineSemaphoreToWaitFor->current_value() >= mTimelineValueToWaitFor;
+		}
+		assert(nullptr != mFenceToWaitFor);
+		return mFenceToWaitFor->is_signalled();
+	}
+
+	submission_batch::submission_batch(submission_batch&& aOther) noexcept
+		: mRoot{ std::move(aOther.mRoot) }
+		, mQueueToSubmitTo{ std::move(aOther.mQueueToSubmitTo) }
+		, mSubmissions{ std::move(aOther.mSubmissions) }
+		, mFence{ std::move(aOther.mFence) }
+		, mSubmissionCount{ std::move(aOther.mSubmissionCount) }
+	{
+		aOther.mRoot = nullptr;
+		aOther.mQueueToSubmitTo = nullptr;
+		aOther.mSubmissions.clear();
+		aOther.mFence.reset();
+		aOther.mSubmissionCount = 0u;
+	}
+
+	submission_batch& submission_batch::operator=(submission_batch&& aOther) noexcept
+	{
+		mRoot = std::move(aOther.mRoot);
+		mQueueToSubmitTo = std::move(aOther.mQueueToSubmitTo);
+		mSubmissions = std::move(aOther.mSubmissions);
+		mFence = std::move(aOther.mFence);
+		mSubmissionCount = std::move(aOther.mSubmissionCount);
+
+		aOther.mRoot = nullptr;
+		aOther.mQueueToSubmitTo = nullptr;
+		aOther.mSubmissions.clear();
+		aOther.mFence.reset();
+		aOther.mSubmissionCount = 0u;
+
+		return *this;
+	}
+
+	submission_batch::~submission_batch() noexcept(false)
+	{
+		if (is_sane() && 0 == mSubmissionCount && !mSubmissions.empty()) {
+			submit();
+		}
+	}
+
+	submission_data& submission_batch::add(avk::resource_argument<avk::command_buffer_t> aCommandBuffer)
+	{
+		return mSubmissions.emplace_back(mRoot, std::move(aCommandBuffer), *mQueueToSubmitTo);
+	}
+
+	submission_batch& submission_batch::add(submission_data&& aSubmission)
+	{
+		if (nullptr != aSubmission.mQueueToSubmitTo && !(*aSubmission.mQueueToSubmitTo == *mQueueToSubmitTo)) {
+			throw avk::logic_error("A submission which is to be submitted to a different queue can not be added to this submission_batch.");
+		}
+		auto& added = mSubmissions.emplace_back(std::move(aSubmission));
+		added.mQueueToSubmitTo = mQueueToSubmitTo;
+		return *this;
+	}
+
+	submission_batch& submission_batch::signaling_upon_completion(avk::resource_argument<avk::fence_t> aFence)
+	{
+		mFence = std::move(aFence);
+		return *this;
+	}
+
+	void submission_batch::submit()
+	{
+		// Count all of them as submitted up-front. This prevents them from being submitted
+		// again in their destructors---also if the submission fails with an exception:
+		for (auto& submission : mSubmissions) {
+			++submission.mSubmissionCount;
+		}
+		++mSubmissionCount;
+
+		const auto n = mSubmissions.size();
+
+		// Gather the semaphore infos of all submissions first, so that their memory does not move anymore afterwards:
+		std::vector<std::vector<vk::SemaphoreSubmitInfoKHR>> waitSems(n);
+		std::vector<std::vector<vk::SemaphoreSubmitInfoKHR>> signalSems(n);
+		std::vector<vk::CommandBufferSubmitInfoKHR> cmdBfrSubmitInfos;
+		cmdBfrSubmitInfos.reserve(n);
+		auto fenceHandle = mFence.has_value() ? mFence.value()->handle() : vk::Fence{};
+		for (size_t i = 0; i < n; ++i) {
+			auto& submission = mSubmissions[i];
+			submission.gather_semaphore_submit_infos(waitSems[i], signalSems[i]);
+			cmdBfrSubmitInfos.emplace_back().setCommandBuffer(submission.mCommandBufferToSubmit->handle());
+
+			if (submission.mFence.has_value()) {
+				if (fenceHandle) {
+					throw avk::logic_error("Only one fence can be signaled by a submission_batch, but multiple have been specified.");
+				}
+				fenceHandle = submission.mFence.value()->handle();
+			}
+		}
+
+		std::vector<vk::SubmitInfo2KHR> submitInfos;
+		submitInfos.reserve(n);
+		for (size_t i = 0; i < n; ++i) {
+			submitInfos.push_back(vk::SubmitInfo2KHR{}
+				.setWaitSemaphoreInfoCount(static_cast<uint32_t>(waitSems[i].size()))
+				.setPWaitSemaphoreInfos(waitSems[i].data())
+				.setCommandBufferInfoCount(1u)
+				.setPCommandBufferInfos(&cmdBfrSubmitInfos[i])
+				.setSignalSemaphoreInfoCount(static_cast<uint32_t>(signalSems[i].size()))
+				.setPSignalSemaphoreInfos(signalSems[i].data())
+			);
+		}
+
+		auto result = mQueueToSubmitTo->handle().submit2KHR(static_cast<uint32_t>(submitInfos.size()), submitInfos.data(), fenceHandle, mRoot->dispatch_loader_ext());
+	}
+
 #pragma endregion
 	
+#pragma region parallel recorder
+	parallel_recorder root::create_parallel_recorder(uint32_t aQueueFamilyIndex, uint32_t aNumWorkers, uint32_t aNumFramesInFlight)
+	{
+		if (0u == aNumWorkers) {
+			aNumWorkers = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		parallel_recorder_t result;
+		result.mRoot = this;
+		result.mQueueFamilyIndex = aQueueFamilyIndex;
+		result.mNumWorkers = aNumWorkers;
+		// Hands out command pools per worker thread and frame in flight => no synchronization required while recording:
+		result.mCommandPoolManager = create_command_pool_manager(aNumFramesInFlight);
+		result.mWorkerThreads = std::make_unique<parallel_recorder_t::worker_threads>();
+		for (uint32_t i = 0; i < aNumWorkers; ++i) {
+			result.mWorkerThreads->mThreads.emplace_back(&parallel_recorder_t::worker_loop, result.mWorkerThreads.get(), i);
+		}
+		return result;
+	}
+
+	parallel_recorder_t& parallel_recorder_t::operator=(parallel_recorder_t&& aOther) noexcept
+	{
+		stop_workers();
+		mRoot = aOther.mRoot;
+		mQueueFamilyIndex = aOther.mQueueFamilyIndex;
+		mNumWorkers = aOther.mNumWorkers;
+		mFrameInFlightIndex = aOther.mFrameInFlightIndex;
+		mCommandPoolManager = std::move(aOther.mCommandPoolManager);
+		mWorkerThreads = std::move(aOther.mWorkerThreads);
+		return *this;
+	}
+
+	parallel_recorder_t::~parallel_recorder_t()
+	{
+		stop_workers();
+		// The command pools are destroyed only after all the workers have finished
+	}
+
+	void parallel_recorder_t::stop_workers()
+	{
+		if (!mWorkerThreads) {
+			return;
+		}
+		{
+			std::scoped_lock lock{ mWorkerThreads->mMutex };
+			mWorkerThreads->mStop = true;
+		}
+		mWorkerThreads->mWorkAvailable.notify_all();
+		for (auto& t : mWorkerThreads->mThreads) {
+			t.join();
+		}
+		mWorkerThreads.reset();
+	}
+
+	void parallel_recorder_t::worker_loop(worker_threads* aWorkerThreads, uint32_t aWorkerIndex)
+	{
+		uint64_t lastGeneration = 0;
+		std::unique_lock lock{ aWorkerThreads->mMutex };
+		for (;;) {
+			aWorkerThreads->mWorkAvailable.wait(lock, [aWorkerThreads, &lastGeneration]() {
+				return aWorkerThreads->mStop || aWorkerThreads->mGeneration != lastGeneration;
+			});
+			if (aWorkerThreads->mStop) {
+				return;
+			}
+			lastGeneration = aWorkerThreads->mGeneration;
+			auto job = aWorkerThreads->mJob;
+			lock.unlock();
+
+			try {
+				job(aWorkerIndex);
+			}
+			catch (...) {
+				lock.lock();
+				if (!aWorkerThreads->mException) {
+					aWorkerThreads->mException = std::current_exception();
+				}
+				lock.unlock();
+			}
+
+			lock.lock();
+			if (0u == --aWorkerThreads->mNumBusy) {
+				aWorkerThreads->mWorkDone.notify_all();
+			}
+		}
+	}
+
+	void parallel_recorder_t::run_on_all_workers(std::function<void(uint32_t)> aJob)
+	{
+		assert(mWorkerThreads);
+		auto& w = *mWorkerThreads;
+
+		// A worker which dispatches a job would wait for itself to finish it:
+		const auto callerId = std::this_thread::get_id();
+		if (std::any_of(std::begin(w.mThreads), std::end(w.mThreads), [callerId](const std::thread& lThread) { return lThread.get_id() == callerId; })) {
+			throw avk::logic_error("A parallel_recorder must not be used from within chunks which are recorded by itself.");
+		}
+
+		// Only one job at a time:
+		std::scoped_lock dispatchLock{ w.mDispatchMutex };
+
+		std::unique_lock lock{ w.mMutex };
+		w.mJob = std::move(aJob);
+		w.mException = nullptr;
+		w.mNumBusy = static_cast<uint32_t>(w.mThreads.size());
+		++w.mGeneration;
+		w.mWorkAvailable.notify_all();
+		w.mWorkDone.wait(lock, [&w]() { return 0u == w.mNumBusy; });
+		w.mJob = {};
+
+		if (w.mException) {
+			std::rethrow_exception(w.mException);
+		}
+	}
+
+	std::vector<std::vector<recorded_commands_t>> parallel_recorder_t::split(std::vector<recorded_commands_t> aCommands, uint32_t aNumChunks)
+	{
+		std::vector<std::vector<recorded_commands_t>> result;
+		if (aCommands.empty()) {
+			return result;
+		}
+
+		const size_t n = aCommands.size();
+		aNumChunks = static_cast<uint32_t>(std::clamp(static_cast<size_t>(aNumChunks), size_t{ 1 }, n));
+		result.resize(aNumChunks);
+		for (size_t c = 0; c < aNumChunks; ++c) {
+			const auto from = static_cast<ptrdiff_t>(n * c / aNumChunks);
+			const auto to   = static_cast<ptrdiff_t>(n * (c + 1) / aNumChunks);
+			result[c].insert(std::end(result[c]), std::make_move_iterator(std::begin(aCommands) + from), std::make_move_iterator(std::begin(aCommands) + to));
+		}
+		return result;
+	}
+
+	void parallel_recorder_t::begin_frame(uint32_t aFrameInFlightIndex)
+	{
+		mCommandPoolManager->reset_frame(aFrameInFlightIndex);
+		mFrameInFlightIndex = aFrameInFlightIndex;
+	}
+
+	std::vector<std::reference_wrapper<command_buffer_t>> parallel_recorder_t::record_in_parallel(const std::vector<std::vector<recorded_commands_t>>& aChunks, vk::CommandBufferInheritanceInfo aInheritanceInfo)
+	{
+		std::vector<std::reference_wrapper<command_buffer_t>> result;
+		if (aChunks.empty()) {
+			return result;
+		}
+
+		// Secondary command buffers which are executed within a renderpass or within dynamic rendering continue it:
+		bool continuesRendering = static_cast<bool>(aInheritanceInfo.renderPass);
+		for (auto* next = static_cast<const vk::BaseInStructure*>(aInheritanceInfo.pNext); nullptr != next && !continuesRendering; next = next->pNext) {
+			continuesRendering = vk::StructureType::eCommandBufferInheritanceRenderingInfoKHR == next->sType;
+		}
+		const auto usageFlags = continuesRendering
+			? vk::CommandBufferUsageFlagBits::eOneTimeSubmit | vk::CommandBufferUsageFlagBits::eRenderPassContinue
+			: vk::CommandBufferUsageFlags{ vk::CommandBufferUsageFlagBits::eOneTimeSubmit };
+
+		std::vector<command_buffer_t*> recorded(aChunks.size(), nullptr);
+		std::atomic<size_t> nextChunk{ 0 };
+		run_on_all_workers([this, &aChunks, &aInheritanceInfo, &recorded, &nextChunk, usageFlags](uint32_t bWorkerIndex) {
+			for (size_t i = nextChunk++; i < aChunks.size(); i = nextChunk++) {
+				// Every worker thread gets command buffers from its own pool for the current frame in flight:
+				auto& cb = mCommandPoolManager->get_command_buffer(mFrameInFlightIndex, mQueueFamilyIndex, vk::CommandBufferLevel::eSecondary);
+				cb.set_usage_flags(usageFlags);
+				cb.set_inheritance_info(aInheritanceInfo);
+				cb.begin_recording();
+				record_into_command_buffer(cb, mRoot->dispatch_loader_ext(), aChunks[i]);
+				cb.end_recording();
+				recorded[i] = &cb;
+			}
+		});
+
+		result.reserve(recorded.size());
+		for (auto* cb : recorded) {
+			result.emplace_back(*cb);
+		}
+		return result;
+	}
+
+	avk::command::action_type_command parallel_recorder_t::execute_in_secondary_command_buffers(std::vector<std::vector<recorded_commands_t>> aChunks, vk::CommandBufferInheritanceInfo aInheritanceInfo, std::optional<rendering_inheritance> aRenderingInheritance)
+	{
+		avk::command::action_type_command result;
+
+		// Accumulate the sync hints of all nested action-type commands of all chunks:
+		vk::PipelineStageFlags2KHR dstStageForPrevCmds  = vk::PipelineStageFlagBits2KHR::eNone;
+		vk::AccessFlags2KHR        dstAccessForPrevCmds = vk::AccessFlagBits2KHR::eNone;
+		vk::PipelineStageFlags2KHR srcStageForSubsCmds  = vk::PipelineStageFlagBits2KHR::eNone;
+		vk::AccessFlags2KHR        srcAccessForSubsCmds = vk::AccessFlagBits2KHR::eNone;
+		for (const auto& chunk : aChunks) {
+			for (const auto& recordee : chunk) {
+				if (!std::holds_alternative<avk::command::action_type_command>(recordee)) {
+					continue;
+				}
+				const auto& syncHint = std::get<avk::command::action_type_command>(recordee).mSyncHint;
+				if (syncHint.mDstForPreviousCmds.has_value()) {
+					dstStageForPrevCmds  |= syncHint.mDstForPreviousCmds.value().mStage;
+					dstAccessForPrevCmds |= syncHint.mDstForPreviousCmds.value().mAccess;
+				}
+				if (syncHint.mSrcForSubsequentCmds.has_value()) {
+					srcStageForSubsCmds  |= syncHint.mSrcForSubsequentCmds.value().mStage;
+					srcAccessForSubsCmds |= syncHint.mSrcForSubsequentCmds.value().mAccess;
+				}
+			}
+		}
+		result.mSyncHint.mDstForPreviousCmds   = { dstStageForPrevCmds, dstAccessForPrevCmds };
+		result.mSyncHint.mSrcForSubsequentCmds = { srcStageForSubsCmds, srcAccessForSubsCmds };
+
+		// Make the chunks shareable, s.t. the recording function stays copyable:
+		auto sharedChunks = std::make_shared<std::vector<std::vector<recorded_commands_t>>>(std::move(aChunks));
+		result.mBeginFun = [this, sharedChunks, aInheritanceInfo, lRenderingInheritance = std::move(aRenderingInheritance)](avk::command_buffer_t& cb) {
+			// Chain the formats for dynamic rendering; they only have to stay valid until the secondary command buffers have begun recording:
+			auto inheritanceInfo = aInheritanceInfo;
+			vk::CommandBufferInheritanceRenderingInfoKHR renderingInfo;
+			if (lRenderingInheritance.has_value()) {
+				renderingInfo
+					.setColorAttachmentCount(static_cast<uint32_t>(lRenderingInheritance->mColorAttachmentFormats.size()))
+					.setPColorAttachmentFormats(lRenderingInheritance->mColorAttachmentFormats.data())
+					.setDepthAttachmentFormat(lRenderingInheritance->mDepthAttachmentFormat)
+					.setStencilAttachmentFormat(lRenderingInheritance->mStencilAttachmentFormat)
+					.setRasterizationSamples(lRenderingInheritance->mRasterizationSamples);
+				inheritanceInfo.setPNext(&renderingInfo);
+			}
+
+			auto secondaries = record_in_parallel(*sharedChunks, inheritanceInfo);
+			if (secondaries.empty()) {
+				return;
+			}
+
+			std::vector<vk::CommandBuffer> handles;
+			handles.reserve(secondaries.size());
+			for (const auto& secondary : secondaries) {
+				handles.push_back(secondary.get().handle());
+			}
+			cb.handle().executeCommands(static_cast<uint32_t>(handles.size()), handles.data(), cb.root_ptr()->dispatch_loader_core());
+			// The state which is bound after executing secondary command buffers is undefined:
+			cb.invalidate_bound_state();
+
+			// The secondary command buffers are recycled by begin_frame(), but the resources referenced by the chunks must stay alive as long as cb:
+			cb.set_custom_deleter([lChunks = sharedChunks]() {});
+		};
+
+		return result;
+	}
+
+	avk::command::action_type_command parallel_recorder_t::render_pass(const renderpass_t& aRenderpass, const framebuffer_t& aFramebuffer, std::vector<std::vector<recorded_commands_t>> aChunks, vk::Offset2D aRenderAreaOffset, std::optional<vk::Extent2D> aRenderAreaExtent)
+	{
+		auto result = avk::command::render_pass(aRenderpass, aFramebuffer, {}, aRenderAreaOffset, aRenderAreaExtent, /* aSubpassesInline: */ false);
+		result.mNestedCommandsAndSyncInstructions.push_back(execute_in_secondary_command_buffers(
+			std::move(aChunks),
+			vk::CommandBufferInheritanceInfo{}
+				.setRenderPass(aRenderpass.handle())
+				.setSubpass(0u)
+				.setFramebuffer(aFramebuffer.handle())
+		));
+		return result;
+	}
+
+	avk::command::action_type_command parallel_recorder_t::rendering(std::vector<rendering_attachment> aColorAttachments, std::optional<rendering_attachment> aDepthStencilAttachment, std::vector<std::vector<recorded_commands_t>> aChunks, vk::Offset2D aRenderAreaOffset, std::optional<vk::Extent2D> aRenderAreaExtent, uint32_t aLayerCount)
+	{
+		// Secondary command buffers which are executed within dynamic rendering must know the formats they render into:
+		rendering_inheritance inheritance;
+		for (const auto& a : aColorAttachments) {
+			inheritance.mColorAttachmentFormats.push_back(a.format());
+			inheritance.mRasterizationSamples = a.sample_count();
+		}
+		if (aDepthStencilAttachment.has_value()) {
+			if (aDepthStencilAttachment->has_depth_component()) {
+				inheritance.mDepthAttachmentFormat = aDepthStencilAttachment->format();
+			}
+			if (aDepthStencilAttachment->has_stencil_component()) {
+				inheritance.mStencilAttachmentFormat = aDepthStencilAttachment->format();
+			}
+			inheritance.mRasterizationSamples = aDepthStencilAttachment->sample_count();
+		}
+
+		auto result = avk::command::rendering(std::move(aColorAttachments), std::move(aDepthStencilAttachment), {}, aRenderAreaOffset, aRenderAreaExtent, aLayerCount, /* aContentsInline: */ false);
+		result.mNestedCommandsAndSyncInstructions.push_back(execute_in_secondary_command_buffers(
+			std::move(aChunks),
+			vk::CommandBufferInheritanceInfo{},
+			std::move(inheritance)
+		));
+		return result;
+	}
+
+	avk::command::action_type_command parallel_recorder_t::execute(std::vector<std::vector<recorded_commands_t>> aChunks)
+	{
+		return execute_in_secondary_command_buffers(std::move(aChunks), vk::CommandBufferInheritanceInfo{});
+	}
+#pragma endregion
+
+#pragma region submission worker
+	submission_worker root::create_submission_worker(const queue& aQueue) const
+	{
+		submission_worker_t result;
+		result.mRoot = this;
+		result.mQueue = &aQueue;
+		result.mWorkerThread = std::make_unique<submission_worker_t::worker_thread>();
+		result.mWorkerThread->mThread = std::thread(&submission_worker_t::worker_loop, result.mRoot, result.mQueue, result.mWorkerThread.get());
+		return result;
+	}
+
+	submission_worker_t& submission_worker_t::operator=(submission_worker_t&& aOther) noexcept
+	{
+		stop_worker();
+		mRoot = aOther.mRoot;
+		mQueue = aOther.mQueue;
+		mWorkerThread = std::move(aOther.mWorkerThread);
+		return *this;
+	}
+
+	submission_worker_t::~submission_worker_t()
+	{
+		stop_worker();
+	}
+
+	void submission_worker_t::stop_worker()
+	{
+		if (!mWorkerThread) {
+			return;
+		}
+		// The worker thread submits everything which is still pending before it stops:
+		mWorkerThread->mStop.store(true, std::memory_order_release);
+		mWorkerThread->mNumPushes.fetch_add(1u, std::memory_order_release);
+		mWorkerThread->mNumPushes.notify_one();
+		mWorkerThread->mThread.join();
+		mWorkerThread.reset();
+	}
+
+	void submission_worker_t::validate(const submission_data& aSubmission) const
+	{
+		if (nullptr != aSubmission.mQueueToSubmitTo && !(*aSubmission.mQueueToSubmitTo == *mQueue)) {
+			throw avk::logic_error("A submission which is to be submitted to a different queue can not be pushed to this submission_worker.");
+		}
+	}
+
+	void submission_worker_t::enqueue(node* aNode)
+	{
+		assert(mWorkerThread);
+		auto* head = mWorkerThread->mHead.load(std::memory_order_relaxed);
+		do {
+			aNode->mNext = head;
+		} while (!mWorkerThread->mHead.compare_exchange_weak(head, aNode, std::memory_order_release, std::memory_order_relaxed));
+		mWorkerThread->mNumPushes.fetch_add(1u, std::memory_order_release);
+		mWorkerThread->mNumPushes.notify_one();
+	}
+
+	std::future<void> submission_worker_t::push(submission_data&& aSubmission)
+	{
+		validate(aSubmission);
+		auto* n = new node{ std::move(aSubmission) };
+		auto future = n->mPromise.get_future();
+		enqueue(n);
+		return future;
+	}
+
+	void submission_worker_t::push(submission_data&& aSubmission, std::function<void(std::exception_ptr)> aOnSubmitted)
+	{
+		validate(aSubmission);
+		enqueue(new node{ std::move(aSubmission), std::promise<void>{}, std::move(aOnSubmitted) });
+	}
+
+	void submission_worker_t::worker_loop(const root* aRoot, const queue* aQueue, worker_thread* aWorkerThread)
+	{
+		std::vector<std::unique_ptr<node>> nodes;
+		for (;;) {
+			const auto numPushes = aWorkerThread->mNumPushes.load(std::memory_order_acquire);
+			auto* list = aWorkerThread->mHead.exchange(nullptr, std::memory_order_acquire);
+			if (nullptr == list) {
+				if (aWorkerThread->mStop.load(std::memory_order_acquire)) {
+					return;
+				}
+				aWorkerThread->mNumPushes.wait(numPushes, std::memory_order_acquire);
+				continue;
+			}
+
+			// The list is in reverse order of pushing => restore the original order:
+			nodes.clear();
+			for (auto* n = list; nullptr != n; ) {
+				auto* next = n->mNext;
+				nodes.emplace_back(n);
+				n = next;
+			}
+			std::reverse(std::begin(nodes), std::end(nodes));
+
+			auto report = [](node& lNode, std::exception_ptr lException) {
+				if (lException) {
+					lNode.mPromise.set_exception(lException);
+				}
+				else {
+					lNode.mPromise.set_value();
+				}
+				if (!lNode.mOnSubmitted) {
+					return;
+				}
+				// Nothing must escape the worker thread, and the remaining submissions must still be reported:
+				try {
+					lNode.mOnSubmitted(lException);
+				}
+				catch (std::exception& e) {
+					AVK_LOG_ERROR("The callback of a submission_worker's submission has thrown an exception: " + std::string(e.what()));
+				}
+				catch (...) {
+					AVK_LOG_ERROR("The callback of a submission_worker's submission has thrown an unknown exception.");
+				}
+			};
+
+			// Submit them with as few vkQueueSubmit2 calls as possible (they have been validated in push).
+			// A batch can only signal one fence => start a new batch whenever another fence would be added:
+			size_t batchBegin = 0;
+			while (batchBegin < nodes.size()) {
+				bool batchHasFence = false;
+				size_t batchEnd = batchBegin;
+				while (batchEnd < nodes.size()) {
+					const bool hasFence = nodes[batchEnd]->mSubmission.mFence.has_value();
+					if (hasFence && batchHasFence) {
+						break;
+					}
+					batchHasFence = batchHasFence || hasFence;
+					++batchEnd;
+				}
+
+				// Errors are only reported to the submissions of the batch which failed:
+				std::exception_ptr exception;
+				try {
+					auto batch = submission_batch(aRoot, *aQueue);
+					for (size_t i = batchBegin; i < batchEnd; ++i) {
+						batch.add(std::move(nodes[i]->mSubmission));
+					}
+					batch.submit();
+				}
+				catch (...) {
+					exception = std::current_exception();
+				}
+				for (size_t i = batchBegin; i < batchEnd; ++i) {
+					report(*nodes[i], exception);
+				}
+				batchBegin = batchEnd;
+			}
+			nodes.clear(); // <-- Frees the nodes
+		}
+	}
+#pragma endregion
+
+#pragma region completion tracker
+	completion_tracker root::create_completion_tracker() const
+	{
+		completion_tracker_t result;
+		result.mRoot = this;
+		result.mMutex = std::make_unique<std::mutex>();
+		return result;
+	}
+
+	submission_data& completion_tracker_t::track(submission_data& aSubmission, std::function<void()> aCompletionHandler, std::vector<any_owning_resource_t> aResourcesToRelease)
+	{
+		if (aSubmission.mFence.has_value()) {
+			throw avk::logic_error("The submission passed to completion_tracker_t::track already signals a fence.");
+		}
+
+		auto f = acquire_fence();
+		std::scoped_lock lock{ *mMutex };
+		aSubmission.signaling_upon_completion(f); // <-- f has shared ownership enabled => both share the same fence
+
+		mPendingSubmissions.push_back(pending_submission{
+			std::move(f),
+			aSubmission.mCommandBufferToSubmit, // <-- Must be a reference or have shared ownership enabled
+			std::move(aCompletionHandler),
+			std::move(aResourcesToRelease)
+		});
+		return aSubmission;
+	}
+
+	size_t completion_tracker_t::poll()
+	{
+		std::vector<pending_submission> completed;
+		{
+			std::scoped_lock lock{ *mMutex };
+			auto it = std::stable_partition(std::begin(mPendingSubmissions), std::end(mPendingSubmissions), [](const pending_submission& lPending) {
+				return !lPending.mFence->is_signalled();
+			});
+			std::move(it, std::end(mPendingSubmissions), std::back_inserter(completed));
+			mPendingSubmissions.erase(it, std::end(mPendingSubmissions));
+		}
+
+		// Invoke the handlers without holding the lock, so that they can track further submissions.
+		// If a handler throws, the others must still be handled => rethrow afterwards:
+		std::exception_ptr firstException;
+		for (auto& c : completed) {
+			try {
+				complete(c);
+			}
+			catch (...) {
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		}
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+		return completed.size();
+	}
+
+	void completion_tracker_t::wait_idle()
+	{
+		std::vector<pending_submission> pending;
+		{
+			std::scoped_lock lock{ *mMutex };
+			pending = std::move(mPendingSubmissions);
+			mPendingSubmissions.clear();
+		}
+
+		std::exception_ptr firstException;
+		for (size_t i = 0; i < pending.size(); ++i) {
+			try {
+				pending[i].mFence->wait_until_signalled();
+			}
+			catch (...) {
+				// It is unknown whether this and the following submissions have completed => keep tracking them:
+				std::scoped_lock lock{ *mMutex };
+				mPendingSubmissions.insert(std::begin(mPendingSubmissions), std::make_move_iterator(std::begin(pending) + i), std::make_move_iterator(std::end(pending)));
+				throw;
+			}
+			try {
+				complete(pending[i]);
+			}
+			catch (...) {
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		}
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+	}
+
+	size_t completion_tracker_t::num_pending() const
+	{
+		std::scoped_lock lock{ *mMutex };
+		return mPendingSubmissions.size();
+	}
+
+	size_t completion_tracker_t::num_pooled_fences() const
+	{
+		std::scoped_lock lock{ *mMutex };
+		return mAvailableFences.size();
+	}
+
+	void completion_tracker_t::complete(pending_submission& aCompleted)
+	{
+		// Even if a handler throws, the resources must be released and the fence must be recycled:
+		std::exception_ptr firstException;
+		if (aCompleted.mCommandBuffer.has_value()) {
+			try {
+				aCompleted.mCommandBuffer.value()->invoke_post_execution_handler();
+			}
+			catch (...) {
+				firstException = std::current_exception();
+			}
+		}
+		if (aCompleted.mCompletionHandler) {
+			try {
+				aCompleted.mCompletionHandler();
+			}
+			catch (...) {
+				if (!firstException) {
+					firstException = std::current_exception();
+				}
+			}
+		}
+
+		// Release all the resources which were only kept alive for the submission:
+		aCompleted.mResourcesToRelease.clear();
+		if (aCompleted.mCommandBuffer.has_value()) {
+			auto& cb = aCompleted.mCommandBuffer.value();
+			if (!std::holds_alternative<std::reference_wrapper<const command_buffer_t>>(*cb.this_as_variant())) {
+				cb.get().release_lifetime_handled_resources();
+			}
+			aCompleted.mCommandBuffer.reset();
+		}
+
+		recycle_fence(std::move(aCompleted.mFence));
+		if (firstException) {
+			std::rethrow_exception(firstException);
+		}
+	}
+
+	fence completion_tracker_t::acquire_fence()
+	{
+		{
+			std::scoped_lock lock{ *mMutex };
+			if (!mAvailableFences.empty()) {
+				auto f = std::move(mAvailableFences.back());
+				mAvailableFences.pop_back();
+				return f;
+			}
+		}
+		return root::create_fence(mRoot->device(), mRoot->dispatch_loader_core());
+	}
+
+	void completion_tracker_t::recycle_fence(fence aFence)
+	{
+		aFence->reset();
+		std::scoped_lock lock{ *mMutex };
+		mAvailableFences.push_back(std::move(aFence));
+	}
+#pragma endregion
+
+#pragma region queue scheduler
+	queue_scheduler root::create_queue_scheduler(const queue& aGraphicsQueue, const queue* aAsyncComputeQueue, const queue* aTransferQueue, uint32_t aNumFramesInFlight)
+	{
+		queue_scheduler_t result;
+		result.mRoot = this;
+
+		// One entry per distinct queue, each with its own timeline semaphore:
+		auto getQueueDataIndex = [this, &result](const queue& lQueue) {
+			for (size_t i = 0; i < result.mQueueData.size(); ++i) {
+				if (*result.mQueueData[i].mQueue == lQueue) {
+					return i;
+				}
+			}
+			result.mQueueData.push_back(queue_scheduler_t::queue_data{ &lQueue, create_timeline_semaphore() });
+			return result.mQueueData.size() - 1;
+		};
+		result.mQueueDataIndexForRole[static_cast<size_t>(queue_role::graphics)]      = getQueueDataIndex(aGraphicsQueue);
+		result.mQueueDataIndexForRole[static_cast<size_t>(queue_role::async_compute)] = getQueueDataIndex(nullptr != aAsyncComputeQueue ? *aAsyncComputeQueue : aGraphicsQueue);
+		result.mQueueDataIndexForRole[static_cast<size_t>(queue_role::transfer)]      = getQueueDataIndex(nullptr != aTransferQueue ? *aTransferQueue : aGraphicsQueue);
+
+		result.mCommandPoolManager = create_command_pool_manager(aNumFramesInFlight);
+		return result;
+	}
+
+	const queue& queue_scheduler_t::queue_for(queue_role aRole) const
+	{
+		return *mQueueData[mQueueDataIndexForRole[static_cast<size_t>(aRole)]].mQueue;
+	}
+
+	std::tuple<const avk::semaphore_t&, uint64_t> queue_scheduler_t::timeline_for(queue_role aRole) const
+	{
+		const auto& qd = mQueueData[mQueueDataIndexForRole[static_cast<size_t>(aRole)]];
+		return { qd.mTimelineSemaphore.get(), qd.mTimelineValue };
+	}
+
+	queue_scheduler_t::job_index queue_scheduler_t::add(queue_role aRole, std::vector<recorded_commands_t> aCommands, std::vector<dependency> aDependencies)
+	{
+		for (const auto& dep : aDependencies) {
+			if (dep.mJob >= mJobs.size()) {
+				throw avk::logic_error("A job can only depend on previously added jobs, but job index " + std::to_string(dep.mJob) + " has not been added yet.");
+			}
+			for (const auto& handover : dep.mHandovers) {
+				if (!handover.is_image_memory_barrier() && !handover.is_buffer_memory_barrier()) {
+					throw avk::logic_error("The handovers of a queue_scheduler_t::dependency must be image memory barriers or buffer memory barriers.");
+				}
+			}
+		}
+
+		mJobs.push_back(job{ mQueueDataIndexForRole[static_cast<size_t>(aRole)], std::move(aCommands), std::move(aDependencies) });
+		return mJobs.size() - 1;
+	}
+
+	queue_scheduler_t& queue_scheduler_t::waiting_for(job_index aJob, avk::semaphore_wait_info aWaitInfo)
+	{
+		mJobs[aJob].mSemaphoreWaits.push_back(std::move(aWaitInfo));
+		return *this;
+	}
+
+	queue_scheduler_t& queue_scheduler_t::signaling_upon_completion(job_index aJob, avk::semaphore_signal_info aSignalInfo)
+	{
+		mJobs[aJob].mSemaphoreSignals.push_back(std::move(aSignalInfo));
+		return *this;
+	}
+
+	queue_scheduler_t& queue_scheduler_t::signaling_upon_completion(job_index aJob, avk::resource_argument<avk::fence_t> aFence)
+	{
+		mJobs[aJob].mFence = std::move(aFence);
+		return *this;
+	}
+
+	void queue_scheduler_t::submit(uint32_t aFrameInFlightIndex)
+	{
+		const auto numJobs = mJobs.size();
+
+		// Determine the timeline values which the jobs' submissions will signal:
+		std::vector<uint64_t> signalValues(numJobs);
+		for (size_t j = 0; j < numJobs; ++j) {
+			signalValues[j] = ++mQueueData[mJobs[j].mQueueDataIndex].mTimelineValue;
+		}
+
+		// Collect the release barriers, which must be recorded at the end of the earlier jobs:
+		std::vector<std::vector<recorded_commands_t>> releases(numJobs);
+		for (size_t j = 0; j < numJobs; ++j) {
+			const auto dstFamily = mQueueData[mJobs[j].mQueueDataIndex].mQueue->family_index();
+			for (auto& dep : mJobs[j].mDependencies) {
+				const auto srcFamily = mQueueData[mJobs[dep.mJob].mQueueDataIndex].mQueue->family_index();
+				if (srcFamily == dstFamily) {
+					continue;
+				}
+				for (auto handover : dep.mHandovers) {
+					releases[dep.mJob].push_back(handover
+						.with_stages(handover.src_stage() >> avk::stage::none)
+						.with_memory_access(handover.src_access() >> avk::access::none)
+						.with_queue_family_ownership_transfer(srcFamily, dstFamily)
+					);
+				}
+			}
+		}
+
+		mCommandPoolManager->reset_frame(aFrameInFlightIndex);
+
+		std::vector<avk::submission_batch> batches;
+		batches.reserve(mQueueData.size());
+		for (const auto& qd : mQueueData) {
+			batches.emplace_back(mRoot, *qd.mQueue);
+		}
+
+		for (size_t j = 0; j < numJobs; ++j) {
+			auto& jb = mJobs[j];
+			const auto& qd = mQueueData[jb.mQueueDataIndex];
+			const auto dstFamily = qd.mQueue->family_index();
+
+			// Acquire barriers (or regular barriers if on the same queue family), then the job's commands, then the release barriers:
+			std::vector<recorded_commands_t> commands;
+			std::vector<avk::semaphore_wait_info> dependencyWaits;
+			for (auto& dep : jb.mDependencies) {
+				const auto& srcQd = mQueueData[mJobs[dep.mJob].mQueueDataIndex];
+				const auto srcFamily = srcQd.mQueue->family_index();
+				for (auto handover : dep.mHandovers) {
+					if (srcFamily == dstFamily) {
+						commands.push_back(std::move(handover));
+					}
+					else {
+						commands.push_back(handover
+							.with_stages(avk::stage::none >> handover.dst_stage())
+							.with_memory_access(avk::access::none >> handover.dst_access())
+							.with_queue_family_ownership_transfer(srcFamily, dstFamily)
+						);
+					}
+				}
+				if (srcQd.mQueue != qd.mQueue) {
+					dependencyWaits.push_back(avk::with_value(srcQd.mTimelineSemaphore.get(), signalValues[dep.mJob]) >> dep.mWaitStage);
+				}
+			}
+			std::move(std::begin(jb.mCommands), std::end(jb.mCommands), std::back_inserter(commands));
+			std::move(std::begin(releases[j]), std::end(releases[j]), std::back_inserter(commands));
+
+			auto& cb = mCommandPoolManager->get_command_buffer(aFrameInFlightIndex, dstFamily);
+			cb.begin_recording();
+			cb.record(std::move(commands));
+			cb.end_recording();
+
+			auto& submission = batches[jb.mQueueDataIndex].add(cb);
+			for (auto& w : dependencyWaits) {
+				submission.waiting_for(std::move(w));
+			}
+			for (auto& w : jb.mSemaphoreWaits) {
+				submission.waiting_for(std::move(w));
+			}
+			for (auto& s : jb.mSemaphoreSignals) {
+				submission.signaling_upon_completion(std::move(s));
+			}
+			submission.signaling_upon_completion(avk::stage::all_commands >> avk::with_value(qd.mTimelineSemaphore.get(), signalValues[j]));
+			if (jb.mFence.has_value()) {
+				submission.signaling_upon_completion(std::move(jb.mFence.value()));
+			}
+		}
+
+		mJobs.clear();
+		for (auto& batch : batches) {
+			if (batch.num_submissions() > 0) {
+				batch.submit();
+			}
+		}
+	}
+#pragma endregion
+
+#pragma region streaming uploader
+	streaming_uploader root::create_streaming_uploader(const queue& aTransferQueue, uint32_t aConsumerQueueFamilyIndex, vk::DeviceSize aMinStagingBufferSize, std::optional<std::chrono::microseconds> aTickInterval)
+	{
+		streaming_uploader_t result;
+		result.mState = std::make_unique<streaming_uploader_t::state>();
+		auto& st = *result.mState;
+		st.mRoot = this;
+		st.mQueue = &aTransferQueue;
+		st.mConsumerQueueFamilyIndex = aConsumerQueueFamilyIndex;
+		st.mMinStagingBufferSize = aMinStagingBufferSize;
+		st.mCommandPool = create_command_pool(aTransferQueue.family_index(), vk::CommandPoolCreateFlagBits::eTransient);
+		st.mTimelineSemaphore = create_timeline_semaphore();
+
+		if (aTickInterval.has_value()) {
+			st.mTickThread = std::thread([lState = result.mState.get(), lInterval = aTickInterval.value()]() {
+				std::unique_lock lock{ lState->mMutex };
+				for (;;) {
+					if (lState->mStopTicking.wait_for(lock, lInterval, [lState]() { return lState->mStop; })) {
+						return;
+					}
+					lock.unlock();
+					try {
+						submit_pending_requests(*lState);
+					}
+					catch (std::exception& e) {
+						AVK_LOG_ERROR("Submitting pending upload requests failed: " + std::string(e.what()));
+					}
+					lock.lock();
+				}
+			});
+		}
+		return result;
+	}
+
+	streaming_uploader_t& streaming_uploader_t::operator=(streaming_uploader_t&& aOther) noexcept
+	{
+		finish_pending_work();
+		mState = std::move(aOther.mState);
+		return *this;
+	}
+
+	streaming_uploader_t::~streaming_uploader_t()
+	{
+		finish_pending_work();
+	}
+
+	void streaming_uploader_t::finish_pending_work()
+	{
+		stop_tick_thread();
+		if (!mState) {
+			return;
+		}
+		// Requests which have not been submitted yet would be lost otherwise:
+		try {
+			submit_pending_requests(*mState);
+		}
+		catch (std::exception& e) {
+			AVK_LOG_ERROR("Submitting the pending upload requests of a streaming_uploader which is being destroyed failed: " + std::string(e.what()));
+		}
+		// In-flight command buffers and staging buffers must not be destroyed while in use:
+		mState->mTimelineSemaphore->wait(mState->mLastSubmittedValue);
+	}
+
+	void streaming_uploader_t::stop_tick_thread()
+	{
+		if (!mState || !mState->mTickThread.joinable()) {
+			return;
+		}
+		{
+			std::scoped_lock lock{ mState->mMutex };
+			mState->mStop = true;
+		}
+		mState->mStopTicking.notify_all();
+		mState->mTickThread.join();
+	}
+
+	streaming_uploader_t::upload_ticket streaming_uploader_t::enqueue(request aRequest, std::optional<avk::sync::sync_type_command> aAcquireBarrier)
+	{
+		std::scoped_lock lock{ mState->mMutex };
+		mState->mPendingRequests.push_back(std::move(aRequest));
+		// All the pending requests are submitted with the next tick:
+		return upload_ticket{ mState->mNextValue, std::move(aAcquireBarrier) };
+	}
+
+	streaming_uploader_t::upload_ticket streaming_uploader_t::upload(const buffer_t& aDstBuffer, const void* aData, size_t aSize, vk::DeviceSize aDstOffset, avk::stage_and_access aConsumer)
+	{
+		const auto* bytes = static_cast<const uint8_t*>(aData);
+		std::optional<avk::sync::sync_type_command> acquire;
+		if (mState->mQueue->family_index() != mState->mConsumerQueueFamilyIndex) {
+			acquire = avk::sync::buffer_memory_barrier(aDstBuffer, avk::stage::none + avk::access::none >> aConsumer)
+				.for_offset_and_size(aDstOffset, static_cast<vk::DeviceSize>(aSize))
+				.with_queue_family_ownership_transfer(mState->mQueue->family_index(), mState->mConsumerQueueFamilyIndex);
+		}
+		return enqueue(request{ std::vector<uint8_t>(bytes, bytes + aSize), &aDstBuffer, aDstOffset }, std::move(acquire));
+	}
+
+	streaming_uploader_t::upload_ticket streaming_uploader_t::upload(const image_t& aDstImage, const void* aData, size_t aSize, std::vector<vk::BufferImageCopy> aRegions, avk::layout::image_layout_transition aLayoutTransition, avk::stage_and_access aConsumer)
+	{
+		const auto* bytes = static_cast<const uint8_t*>(aData);
+		std::optional<avk::sync::sync_type_command> acquire;
+		if (mState->mQueue->family_index() != mState->mConsumerQueueFamilyIndex) {
+			acquire = avk::sync::image_memory_barrier(aDstImage, avk::stage::none + avk::access::none >> aConsumer)
+				.with_layout_transition(avk::layout::transfer_dst >> aLayoutTransition.mNew)
+				.with_queue_family_ownership_transfer(mState->mQueue->family_index(), mState->mConsumerQueueFamilyIndex);
+		}
+		return enqueue(request{ std::vector<uint8_t>(bytes, bytes + aSize), &aDstImage, 0, std::move(aRegions), aLayoutTransition }, std::move(acquire));
+	}
+
+	uint64_t streaming_uploader_t::tick()
+	{
+		return submit_pending_requests(*mState);
+	}
+
+	vk::DeviceSize streaming_uploader_t::num_staging_bytes() const
+	{
+		std::scoped_lock lock{ mState->mMutex };
+		vk::DeviceSize result = 0;
+		for (const auto& f : mState->mInFlight) {
+			result += f.mStagingBuffer->create_info().size;
+		}
+		for (const auto& b : mState->mAvailableStagingBuffers) {
+			result += b->create_info().size;
+		}
+		return result;
+	}
+
+	buffer streaming_uploader_t::get_staging_buffer(state& aState, vk::DeviceSize aMinSize)
+	{
+		{
+			std::scoped_lock lock{ aState.mMutex };
+			// Take the smallest one which is large enough:
+			auto best = std::end(aState.mAvailableStagingBuffers);
+			for (auto it = std::begin(aState.mAvailableStagingBuffers); it != std::end(aState.mAvailableStagingBuffers); ++it) {
+				const auto size = (*it)->create_info().size;
+				if (size >= aMinSize && (best == std::end(aState.mAvailableStagingBuffers) || size < (*best)->create_info().size)) {
+					best = it;
+				}
+			}
+			if (best != std::end(aState.mAvailableStagingBuffers)) {
+				auto result = std::move(*best);
+				aState.mAvailableStagingBuffers.erase(best);
+				return result;
+			}
+		}
+
+		return root::create_buffer(
+			*aState.mRoot,
+			AVK_STAGING_BUFFER_MEMORY_USAGE,
+			vk::BufferUsageFlagBits::eTransferSrc,
+			generic_buffer_meta::create_from_size(static_cast<size_t>(std::max(aMinSize, aState.mMinStagingBufferSize)))
+		);
+	}
+
+	vk::DeviceSize streaming_uploader_t::staging_alignment(const request& aRequest)
+	{
+		// Offsets into the staging buffer must be multiples of 4 and, for color formats, of the texel block size:
+		if (std::holds_alternative<const buffer_t*>(aRequest.mDst)) {
+			return 4;
+		}
+		const auto format = std::get<const image_t*>(aRequest.mDst)->format();
+		if (is_depth_format(format) || has_stencil_component(format) || vk::Format::eS8Uint == format) {
+			return 4;
+		}
+		return std::lcm(vk::DeviceSize{ 4 }, static_cast<vk::DeviceSize>(texel_block_size(format)));
+	}
+
+	uint64_t streaming_uploader_t::submit_pending_requests(state& aState)
+	{
+		std::scoped_lock submitLock{ aState.mSubmitMutex };
+
+		std::vector<request> requests;
+		uint64_t value;
+		{
+			std::scoped_lock lock{ aState.mMutex };
+
+			// Recycle the staging buffers (and free the command buffers) of completed uploads:
+			const auto completedValue = aState.mTimelineSemaphore->current_value();
+			auto it = std::stable_partition(std::begin(aState.mInFlight), std::end(aState.mInFlight), [completedValue](const in_flight& lInFlight) {
+				return lInFlight.mTimelineValue > completedValue;
+			});
+			for (auto completed = it; completed != std::end(aState.mInFlight); ++completed) {
+				aState.mAvailableStagingBuffers.push_back(std::move(completed->mStagingBuffer));
+			}
+			aState.mInFlight.erase(it, std::end(aState.mInFlight));
+
+			if (aState.mPendingRequests.empty()) {
+				return aState.mLastSubmittedValue;
+			}
+
+			// Take the pending requests, so that upload() does not have to wait for the copying and recording.
+			// Requests which are enqueued from now on get the next timeline value:
+			requests.swap(aState.mPendingRequests);
+			value = aState.mNextValue++;
+		}
+
+		buffer staging;
+		command_buffer cb;
+		try {
+			std::vector<vk::DeviceSize> stagingOffsets;
+			stagingOffsets.reserve(requests.size());
+			vk::DeviceSize totalSize = 0;
+			for (const auto& r : requests) {
+				const auto alignment = staging_alignment(r);
+				totalSize = (totalSize + alignment - 1) / alignment * alignment;
+				stagingOffsets.push_back(totalSize);
+				totalSize += static_cast<vk::DeviceSize>(r.mData.size());
+			}
+
+			staging = get_staging_buffer(aState, totalSize);
+			for (size_t i = 0; i < requests.size(); ++i) {
+				const auto& data = requests[i].mData;
+				if (!data.empty()) {
+					staging->fill(data.data(), 0, static_cast<size_t>(stagingOffsets[i]), data.size()); // <-- Host-visible => copies immediately
+				}
+			}
+
+			cb = record_and_submit(aState, requests, stagingOffsets, staging.get(), value);
+		}
+		catch (...) {
+			// Do not signal the value (its uploads did not happen), but retry the requests with the next submission.
+			// Their tickets' value is skipped then, and satisfied by the greater value of that submission:
+			std::scoped_lock lock{ aState.mMutex };
+			aState.mPendingRequests.insert(std::begin(aState.mPendingRequests), std::make_move_iterator(std::begin(requests)), std::make_move_iterator(std::end(requests)));
+			if (staging.has_value()) {
+				aState.mAvailableStagingBuffers.push_back(std::move(staging));
+			}
+			throw;
+		}
+
+		std::scoped_lock lock{ aState.mMutex };
+		aState.mLastSubmittedValue = value;
+		aState.mInFlight.push_back(in_flight{ value, std::move(cb), std::move(staging) });
+		return value;
+	}
+
+	command_buffer streaming_uploader_t::record_and_submit(state& aState, const std::vector<request>& aRequests, const std::vector<vk::DeviceSize>& aStagingOffsets, const buffer_t& aStaging, uint64_t aTimelineValue)
+	{
+		const auto srcFamily = aState.mQueue->family_index();
+		const auto dstFamily = aState.mConsumerQueueFamilyIndex;
+		const auto& dispatchLoader = aState.mRoot->dispatch_loader_core();
+
+		auto cb = aState.mCommandPool->alloc_command_buffer(vk::CommandBufferUsageFlagBits::eOneTimeSubmit);
+		cb->begin_recording();
+		for (size_t i = 0; i < aRequests.size(); ++i) {
+			const auto& r = aRequests[i];
+			if (std::holds_alternative<const buffer_t*>(r.mDst)) {
+				const auto& dstBuffer = *std::get<const buffer_t*>(r.mDst);
+				const auto dataSize = static_cast<vk::DeviceSize>(r.mData.size());
+				const auto copyRegion = vk::BufferCopy{ aStagingOffsets[i], r.mDstOffset, dataSize };
+				cb->handle().copyBuffer(aStaging.handle(), dstBuffer.handle(), 1u, &copyRegion, dispatchLoader);
+
+				// Within the same queue family, the semaphore signal operation makes the data available:
+				if (srcFamily != dstFamily) {
+					cb->record(avk::sync::buffer_memory_barrier(dstBuffer, avk::stage::copy + avk::access::transfer_write >> avk::stage::none + avk::access::none)
+						.for_offset_and_size(r.mDstOffset, dataSize)
+						.with_queue_family_ownership_transfer(srcFamily, dstFamily)
+					);
+				}
+			}
+			else {
+				const auto& dstImage = *std::get<const image_t*>(r.mDst);
+				cb->record(avk::sync::image_memory_barrier(dstImage, avk::stage::none + avk::access::none >> avk::stage::copy + avk::access::transfer_write)
+					.with_layout_transition(r.mLayoutTransition.mOld >> avk::layout::transfer_dst)
+				);
+
+				// Leave the request's regions untouched, so that it can be retried if the submission fails:
+				auto regions = r.mRegions;
+				for (auto& region : regions) {
+					region.bufferOffset += aStagingOffsets[i];
+				}
+				cb->handle().copyBufferToImage(aStaging.handle(), dstImage.handle(), vk::ImageLayout::eTransferDstOptimal, static_cast<uint32_t>(regions.size()), regions.data(), dispatchLoader);
+
+				// Transition into the target layout, releasing the ownership if required (with the same layout transition as the acquire barrier):
+				auto release = avk::sync::image_memory_barrier(dstImage, avk::stage::copy + avk::access::transfer_write >> avk::stage::none + avk::access::none)
+					.with_layout_transition(avk::layout::transfer_dst >> r.mLayoutTransition.mNew);
+				if (srcFamily != dstFamily) {
+					release.with_queue_family_ownership_transfer(srcFamily, dstFamily);
+				}
+				cb->record(release);
+			}
+		}
+		cb->end_recording();
+
+		aState.mQueue->submit(cb.get())
+			.signaling_upon_completion(avk::stage::all_commands >> avk::with_value(aState.mTimelineSemaphore.get(), aTimelineValue))
+			.submit();
+		return cb;
+	}
+#pragma endregion
+
+#pragma region uniform ring
+	uniform_ring root::create_uniform_ring(vk::DeviceSize aBytesPerFrame, uint32_t aNumFramesInFlight, bool aUsableAsStorageBuffer)
+	{
+		if (0 == aNumFramesInFlight) {
+			throw avk::logic_error("A uniform_ring must have at least one frame in flight.");
+		}
+
+		const auto limits = physical_device().getProperties().limits;
+		auto alignment = std::max(limits.minUniformBufferOffsetAlignment, vk::DeviceSize{ 1 });
+		if (aUsableAsStorageBuffer) {
+			alignment = std::max(alignment, limits.minStorageBufferOffsetAlignment);
+		}
+		// Every region must start at an aligned offset:
+		const auto bytesPerFrame = (aBytesPerFrame + alignment - 1) / alignment * alignment;
+
+		uniform_ring_t result;
+		result.mBytesPerFrame = bytesPerFrame;
+		result.mAlignment = alignment;
+		result.mNumFramesInFlight = aNumFramesInFlight;
+		result.mState = std::make_unique<uniform_ring_t::state>();
+		const auto totalSize = static_cast<size_t>(bytesPerFrame * aNumFramesInFlight);
+		result.mState->mBuffer = aUsableAsStorageBuffer
+			? create_buffer(memory_usage::host_coherent, {}, uniform_buffer_meta::create_from_size(totalSize), storage_buffer_meta::create_from_size(totalSize))
+			: create_buffer(memory_usage::host_coherent, {}, uniform_buffer_meta::create_from_size(totalSize));
+		// Keep it mapped for the whole lifetime of the ring:
+		result.mState->mMapping.emplace(result.mState->mBuffer->map_memory(mapping_access::write));
+		return result;
+	}
+
+	void uniform_ring_t::begin_frame(int64_t aFrameId)
+	{
+		mRegionBegin = static_cast<vk::DeviceSize>(aFrameId % static_cast<int64_t>(mNumFramesInFlight)) * mBytesPerFrame;
+		mState->mNextOffset.store(0, std::memory_order_relaxed);
+	}
+
+	uniform_ring_t::allocation uniform_ring_t::allocate(vk::DeviceSize aSize)
+	{
+		const auto alignedSize = (aSize + mAlignment - 1) / mAlignment * mAlignment;
+		const auto offsetInRegion = mState->mNextOffset.fetch_add(alignedSize, std::memory_order_relaxed);
+		if (offsetInRegion + aSize > mBytesPerFrame) {
+			throw avk::runtime_error("The uniform_ring's region of " + std::to_string(mBytesPerFrame) + " bytes is exhausted. Cannot allocate another " + std::to_string(aSize) + " bytes.");
+		}
+
+		const auto offset = mRegionBegin + offsetInRegion;
+		return allocation{
+			static_cast<uint8_t*>(mState->mMapping->get()) + offset,
+			static_cast<uint32_t>(offset),
+			aSize
+		};
+	}
+
+	vk::DeviceSize uniform_ring_t::bytes_allocated() const
+	{
+		return std::min(mState->mNextOffset.load(std::memory_order_relaxed), mBytesPerFrame);
+	}
+#pragma endregion
+
+#pragma region bindless heap
+	bindless_heap root::create_bindless_heap(uint32_t aMaxSampledImages, uint32_t aMaxSamplers, uint32_t aMaxStorageBuffers, uint32_t aNumFramesInFlight, shader_type aShaderStages)
+	{
+#if VK_HEADER_VERSION >= 235
+		// The heap is built on an update-after-bind descriptor pool, and its layouts could not be combined with descriptor buffer layouts:
+		if (avk::descriptor_backend::descriptor_buffer == descriptor_backend_in_use()) {
+			throw avk::logic_error("A bindless_heap can not be created under the descriptor_buffer backend.");
+		}
+#endif
+		bindless_heap_t result;
+		result.mRoot = this;
+		result.mShaderStages = to_vk_shader_stages(aShaderStages);
+		result.mNumFramesInFlight = std::max(aNumFramesInFlight, 1u);
+		result.mMutex = std::make_unique<std::mutex>();
+		result.mHeaps[bindless_heap_t::kind_index(bindless_resource::sampled_image)].mCapacity = aMaxSampledImages;
+		result.mHeaps[bindless_heap_t::kind_index(bindless_resource::sampler)].mCapacity = aMaxSamplers;
+		result.mHeaps[bindless_heap_t::kind_index(bindless_resource::storage_buffer)].mCapacity = aMaxStorageBuffers;
+
+		// Prepare and allocate all the layouts in the same way as pipelines will, so that they are compatible:
+		std::vector<vk::DescriptorPoolSize> poolSizes;
+		std::vector<std::reference_wrapper<const descriptor_set_layout>> layouts;
+		for (auto kind : { bindless_resource::sampled_image, bindless_resource::sampler, bindless_resource::storage_buffer }) {
+			auto& h = result.mHeaps[bindless_heap_t::kind_index(kind)];
+			if (0u == h.mCapacity) {
+				throw avk::logic_error("The capacities of a bindless_heap must not be zero.");
+			}
+			const auto flags = result.layout_flags(kind, 0u);
+			h.mLayout = descriptor_set_layout::prepare({ result.binding(kind, 0u) });
+			h.mLayout.set_create_flags(flags.mCreateFlags);
+			h.mLayout.set_binding_flags(flags.mBindingFlags);
+			allocate_descriptor_set_layout(h.mLayout);
+			poolSizes.insert(std::end(poolSizes), std::begin(h.mLayout.required_pool_sizes()), std::end(h.mLayout.required_pool_sizes()));
+			layouts.emplace_back(h.mLayout);
+		}
+
+		result.mPool = std::make_shared<descriptor_pool>(create_descriptor_pool(poolSizes, static_cast<int>(layouts.size()), vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind));
+		auto setHandles = result.mPool->allocate(layouts);
+		for (size_t i = 0; i < setHandles.size(); ++i) {
+			result.mHeaps[i].mDescriptorSet.link_to_handle_and_pool(setHandles[i], result.mPool);
+		}
+		return result;
+	}
+
+	uint32_t bindless_heap_t::num_used(bindless_resource aKind) const
+	{
+		std::scoped_lock lock{ *mMutex };
+		const auto& h = mHeaps[kind_index(aKind)];
+		return h.mNumAllocated - static_cast<uint32_t>(h.mFreeIndices.size());
+	}
+
+	binding_data bindless_heap_t::binding(bindless_resource aKind, uint32_t aSetId) const
+	{
+		static const std::array<vk::DescriptorType, 3> sTypes{ vk::DescriptorType::eSampledImage, vk::DescriptorType::eSampler, vk::DescriptorType::eStorageBuffer };
+		return binding_data{
+			aSetId,
+			vk::DescriptorSetLayoutBinding{}
+				.setBinding(0u)
+				.setDescriptorCount(mHeaps[kind_index(aKind)].mCapacity)
+				.setDescriptorType(sTypes[kind_index(aKind)])
+				.setStageFlags(mShaderStages)
+				.setPImmutableSamplers(nullptr)
+		};
+	}
+
+	descriptor_set_layout_flags bindless_heap_t::layout_flags(bindless_resource aKind, uint32_t aSetId) const
+	{
+		return descriptor_set_layout_flags{
+			aSetId,
+			vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool,
+			{ vk::DescriptorBindingFlagBits::eUpdateAfterBind | vk::DescriptorBindingFlagBits::ePartiallyBound }
+		};
+	}
+
+	descriptor_set bindless_heap_t::descriptor_set_for(bindless_resource aKind, uint32_t aSetId) const
+	{
+		auto result = mHeaps[kind_index(aKind)].mDescriptorSet;
+		result.set_set_id(aSetId);
+		return result;
+	}
+
+	uint32_t bindless_heap_t::allocate_index(bindless_resource aKind)
+	{
+		auto& h = mHeaps[kind_index(aKind)];
+		if (!h.mFreeIndices.empty()) {
+			const auto index = h.mFreeIndices.back();
+			h.mFreeIndices.pop_back();
+			return index;
+		}
+		if (h.mNumAllocated == h.mCapacity) {
+			throw avk::runtime_error("The bindless_heap is full. All of its " + std::to_string(h.mCapacity) + " indices are in use, or waiting to be reused.");
+		}
+		return h.mNumAllocated++;
+	}
+
+	void bindless_heap_t::write(bindless_resource aKind, uint32_t aIndex, const vk::DescriptorImageInfo* aImageInfo, const vk::DescriptorBufferInfo* aBufferInfo)
+	{
+		const auto& h = mHeaps[kind_index(aKind)];
+		const auto& binding = h.mLayout.binding_at(0);
+		auto write = vk::WriteDescriptorSet{}
+			.setDstSet(h.mDescriptorSet.handle())
+			.setDstBinding(binding.binding)
+			.setDstArrayElement(aIndex)
+			.setDescriptorCount(1u)
+			.setDescriptorType(binding.descriptorType)
+			.setPImageInfo(aImageInfo)
+			.setPBufferInfo(aBufferInfo);
+		// Update-after-bind allows writing to elements which are not used by pending command buffers:
+		mRoot->device().updateDescriptorSets(1u, &write, 0u, nullptr, mRoot->dispatch_loader_core());
+	}
+
+	uint32_t bindless_heap_t::add(const image_view_t& aImageView, avk::layout::image_layout aLayout)
+	{
+		std::scoped_lock lock{ *mMutex };
+		const auto index = allocate_index(bindless_resource::sampled_image);
+		const auto info = vk::DescriptorImageInfo{ vk::Sampler{}, aImageView.handle(), aLayout.mLayout };
+		write(bindless_resource::sampled_image, index, &info, nullptr);
+		return index;
+	}
+
+	uint32_t bindless_heap_t::add(const sampler_t& aSampler)
+	{
+		std::scoped_lock lock{ *mMutex };
+		const auto index = allocate_index(bindless_resource::sampler);
+		const auto info = vk::DescriptorImageInfo{ aSampler.handle(), vk::ImageView{}, vk::ImageLayout::eUndefined };
+		write(bindless_resource::sampler, index, &info, nullptr);
+		return index;
+	}
+
+	uint32_t bindless_heap_t::add(const buffer_t& aBuffer)
+	{
+		std::scoped_lock lock{ *mMutex };
+		const auto index = allocate_index(bindless_resource::storage_buffer);
+		const auto info = vk::DescriptorBufferInfo{ aBuffer.handle(), 0, VK_WHOLE_SIZE };
+		write(bindless_resource::storage_buffer, index, nullptr, &info);
+		return index;
+	}
+
+	void bindless_heap_t::remove(bindless_resource aKind, uint32_t aIndex)
+	{
+		std::scoped_lock lock{ *mMutex };
+		auto& h = mHeaps[kind_index(aKind)];
+		assert(aIndex < h.mNumAllocated);
+		// The descriptor stays as it is; the index is just not handed out again until the GPU is done with it:
+		h.mRemovedIndices.emplace_back(aIndex, mCurrentFrameId);
+	}
+
+	void bindless_heap_t::begin_frame(int64_t aFrameId)
+	{
+		std::scoped_lock lock{ *mMutex };
+		mCurrentFrameId = aFrameId;
+		for (auto& h : mHeaps) {
+			while (!h.mRemovedIndices.empty() && aFrameId - std::get<int64_t>(h.mRemovedIndices.front()) >= static_cast<int64_t>(mNumFramesInFlight)) {
+				h.mFreeIndices.push_back(std::get<uint32_t>(h.mRemovedIndices.front()));
+				h.mRemovedIndices.pop_front();
+			}
+		}
+	}
+#pragma endregion
+
 	avk::recorded_commands root::record(std::vector<recorded_commands_t> aRecordedCommands) const
 	{
 		return avk::recorded_commands{ this, std::move(aRecordedCommands) };